@@ -0,0 +1,143 @@
+#include "betweenness.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+
+#include "parallel.h"
+
+typedef struct betweennessShared_t {
+    Graph *g;                                    // Graph
+    bool weighted;                               // Use Edge Weights instead of Hops
+    int sources[MAX_VERTICES];                   // Sources to run from
+    double partial[MAX_THREADS][MAX_VERTICES];   // Per-Thread Dependency Accumulators
+} betweennessShared;
+
+// Xorshift Generator local to one Run, so Sampling neither reads nor reseeds the Process-wide rand() State
+typedef struct betweennessRandom_t {
+    uint32_t state; // Current State, never 0
+} betweennessRandom;
+
+// Seed the Generator, mixing the Seed so nearby Seeds start far apart
+static void _randomSeed(betweennessRandom *random, unsigned int seed)
+{
+    random->state = (uint32_t)seed * 0x9E3779B9U + 0x7F4A7C15U;
+    if (random->state == 0)
+        random->state = 1;
+}
+
+// Next Value of the Generator
+static uint32_t _randomNext(betweennessRandom *random)
+{
+    uint32_t x = random->state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return random->state = x;
+}
+
+// Accumulate the Dependencies of every Vertex on one Source (Brandes)
+static void _betweennessSource(int index, int threadId, void *context)
+{
+    betweennessShared *shared = (betweennessShared *)context;
+    Graph *g = shared->g;
+    int s = shared->sources[index];
+
+    int dist[MAX_VERTICES], prev[MAX_VERTICES], order[MAX_VERTICES];
+    int reached;
+    if (shared->weighted)
+        reached = djkDistances(g, s, dist, prev, order);
+    else
+    {
+        reached = bfsDistances(g, s, dist, order);
+        for (int i = 0; i < g->n; i++)
+            if (dist[i] == -1)
+                dist[i] = INT_MAX;
+    }
+
+    // Count Shortest Paths in the Order Vertices were reached, Predecessors always come first
+    double sigma[MAX_VERTICES] = {0}, delta[MAX_VERTICES] = {0};
+    sigma[s] = 1.0;
+    for (int k = 1; k < reached; k++)
+    {
+        int w = order[k];
+        for (int v = 0; v < g->n; v++)
+            if (g->adj[v][w] && dist[v] != INT_MAX && dist[v] + (shared->weighted ? g->adj[v][w] : 1) == dist[w])
+                sigma[w] += sigma[v];
+    }
+
+    // Push Dependencies back from the farthest Vertices
+    for (int k = reached - 1; k > 0; k--)
+    {
+        int w = order[k];
+        for (int v = 0; v < g->n; v++)
+            if (g->adj[v][w] && dist[v] != INT_MAX && dist[v] + (shared->weighted ? g->adj[v][w] : 1) == dist[w])
+                delta[v] += sigma[v] / sigma[w] * (1.0 + delta[w]);
+        shared->partial[threadId][w] += delta[w];
+    }
+}
+
+// Initialize an empty Betweenness Result
+void betweennessInit(BetweennessResult *result)
+{
+    result->version = 0;
+    result->n = 0;
+    result->maxCentrality = 0.0;
+    result->sources = 0;
+    result->seconds = 0.0;
+}
+
+// Betweenness Centrality using Brandes' Algorithm with Sources spread across threadCount Threads
+// If 0 < samples < n, only that many random Sources are used and the Scores are scaled up as an Estimate
+// Returns the Number of Sources used
+int betweennessCentrality(Graph *g, bool weighted, int samples, unsigned int seed, int threadCount, BetweennessResult *result)
+{
+    double start = parallelTime();
+    int n = g->n;
+
+    betweennessShared *shared = (betweennessShared *)calloc(1, sizeof(betweennessShared));
+    shared->g = g;
+    shared->weighted = weighted;
+    for (int i = 0; i < n; i++)
+        shared->sources[i] = i;
+
+    // Partial Fisher-Yates Shuffle picks the sampled Sources
+    int sourceCount = n;
+    if (samples > 0 && samples < n)
+    {
+        betweennessRandom random;
+        _randomSeed(&random, seed);
+        for (int i = 0; i < samples; i++)
+        {
+            int j = i + (int)(_randomNext(&random) % (uint32_t)(n - i));
+            int tmp = shared->sources[i];
+            shared->sources[i] = shared->sources[j];
+            shared->sources[j] = tmp;
+        }
+        sourceCount = samples;
+    }
+
+    if (threadCount > MAX_THREADS)
+        threadCount = MAX_THREADS;
+    parallelFor(sourceCount, threadCount, _betweennessSource, shared);
+
+    // Reduce the per-Thread Accumulators
+    double scale = (sourceCount > 0) ? (double)n / sourceCount : 0.0;
+    result->n = n;
+    result->maxCentrality = 0.0;
+    for (int v = 0; v < n; v++)
+    {
+        double total = 0.0;
+        for (int t = 0; t < MAX_THREADS; t++)
+            total += shared->partial[t][v];
+        result->centrality[v] = total * scale;
+        if (result->centrality[v] > result->maxCentrality)
+            result->maxCentrality = result->centrality[v];
+    }
+    free(shared);
+
+    result->sources = sourceCount;
+    result->seconds = parallelTime() - start;
+    result->version = g->version;
+    return sourceCount;
+}
@@ -0,0 +1,21 @@
+#ifndef _BETWEENNESS_H_
+#define _BETWEENNESS_H_
+
+#include <stdbool.h>
+
+#include "graph.h"
+
+// Betweenness Centrality of every Vertex
+typedef struct betweennessResult_t {
+    unsigned int version;             // Graph Version the Scores were computed for (0 if never computed)
+    int n;                            // Number of Vertices
+    double centrality[MAX_VERTICES];  // Betweenness of each Vertex
+    double maxCentrality;             // Highest Betweenness
+    int sources;                      // Sources used, less than n when sampled
+    double seconds;                   // Wall Time of the Run
+} BetweennessResult;
+
+void betweennessInit(BetweennessResult *result);
+int betweennessCentrality(Graph *g, bool weighted, int samples, unsigned int seed, int threadCount, BetweennessResult *result);
+
+#endif
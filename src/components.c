@@ -0,0 +1,299 @@
+#include "components.h"
+
+#include <stdlib.h>
+#include <pthread.h>
+
+#include "parallel.h"
+#include "unionFind.h"
+
+// Strongly Connected Components using an iterative Tarjan's Algorithm
+// Component IDs are assigned in reverse Topological Order of the Condensation, returns the Component Count
+int stronglyConnectedComponents(Graph *g, int component[])
+{
+    int index[MAX_VERTICES], lowLink[MAX_VERTICES], nextNeighbour[MAX_VERTICES];
+    int stack[MAX_VERTICES], callStack[MAX_VERTICES];
+    bool onStack[MAX_VERTICES];
+    int top = 0, callTop = 0, counter = 0, count = 0;
+
+    for (int i = 0; i < g->n; i++)
+    {
+        index[i] = -1;
+        onStack[i] = false;
+        component[i] = -1;
+    }
+
+    for (int root = 0; root < g->n; root++)
+    {
+        if (index[root] != -1)
+            continue;
+
+        index[root] = lowLink[root] = counter++;
+        nextNeighbour[root] = 0;
+        stack[top++] = root;
+        onStack[root] = true;
+        callStack[callTop++] = root;
+
+        while (callTop > 0) {
+            int u = callStack[callTop - 1];
+            int v = nextNeighbour[u];
+            while (v < g->n && !g->adj[u][v])
+                v++;
+
+            // Descend into the next Neighbour
+            if (v < g->n)
+            {
+                nextNeighbour[u] = v + 1;
+                if (index[v] == -1)
+                {
+                    index[v] = lowLink[v] = counter++;
+                    nextNeighbour[v] = 0;
+                    stack[top++] = v;
+                    onStack[v] = true;
+                    callStack[callTop++] = v;
+                }
+                else if (onStack[v] && index[v] < lowLink[u])
+                    lowLink[u] = index[v];
+                continue;
+            }
+
+            // All Neighbours done, return to the Caller
+            callTop--;
+            if (callTop > 0 && lowLink[u] < lowLink[callStack[callTop - 1]])
+                lowLink[callStack[callTop - 1]] = lowLink[u];
+
+            if (lowLink[u] == index[u])
+            {
+                int w;
+                do {
+                    w = stack[--top];
+                    onStack[w] = false;
+                    component[w] = count;
+                } while (w != u);
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------
+// Parallel Forward-Backward Strongly Connected Components
+
+typedef struct sccTask_t {
+    int count;                  // Number of Vertices in the Subgraph
+    int vertices[MAX_VERTICES]; // Vertices of the Subgraph
+} sccTask;
+
+typedef struct sccShared_t {
+    Graph *g;                     // Graph
+    int *component;               // Output Component Array
+    int nextComponent;            // Next free Component ID
+    sccTask *tasks[MAX_VERTICES]; // Subgraphs waiting to be split
+    int taskTop;                  // Task Stack Top Index
+    int pending;                  // Tasks pushed but not yet finished
+    pthread_mutex_t lock;         // Guards the Task Stack
+    pthread_cond_t changed;       // Signalled on Push and when pending reaches 0
+} sccShared;
+
+// Push a Subgraph, or free it if empty
+static void _sccPush(sccShared *shared, sccTask *task)
+{
+    if (task->count == 0)
+    {
+        free(task);
+        return;
+    }
+
+    pthread_mutex_lock(&shared->lock);
+    shared->tasks[shared->taskTop++] = task;
+    shared->pending++;
+    pthread_cond_signal(&shared->changed);
+    pthread_mutex_unlock(&shared->lock);
+}
+
+// Collect Vertices of the Subgraph reachable from pivot, forward or backward
+static void _sccReach(Graph *g, bool member[], int pivot, bool forward, bool reached[])
+{
+    int queue[MAX_VERTICES];
+    int front = 0, rear = 0;
+
+    reached[pivot] = true;
+    queue[rear++] = pivot;
+
+    while (front < rear) {
+        int u = queue[front++];
+        for (int v = 0; v < g->n; v++)
+            if (member[v] && !reached[v] && (forward ? g->adj[u][v] : g->adj[v][u])) {
+                reached[v] = true;
+                queue[rear++] = v;
+            }
+    }
+}
+
+// Trim trivial Components, then split the Subgraph around the SCC of a Pivot
+static void _sccSplit(sccShared *shared, sccTask *task)
+{
+    Graph *g = shared->g;
+    bool member[MAX_VERTICES] = {false};
+    for (int i = 0; i < task->count; i++)
+        member[task->vertices[i]] = true;
+
+    // Vertices without an In-Edge or Out-Edge inside the Subgraph are Components on their own
+    bool trimmed = true;
+    while (trimmed) {
+        trimmed = false;
+        for (int i = 0; i < task->count; i++)
+        {
+            int u = task->vertices[i];
+            if (!member[u])
+                continue;
+
+            bool hasIn = false, hasOut = false;
+            for (int v = 0; v < g->n && !(hasIn && hasOut); v++)
+                if (member[v] && v != u) {
+                    hasOut = hasOut || g->adj[u][v];
+                    hasIn = hasIn || g->adj[v][u];
+                }
+
+            if (!hasIn || !hasOut)
+            {
+                member[u] = false;
+                shared->component[u] = __atomic_fetch_add(&shared->nextComponent, 1, __ATOMIC_RELAXED);
+                trimmed = true;
+            }
+        }
+    }
+
+    int pivot = -1;
+    for (int i = 0; i < task->count && pivot == -1; i++)
+        if (member[task->vertices[i]])
+            pivot = task->vertices[i];
+    if (pivot == -1)
+    {
+        free(task);
+        return;
+    }
+
+    bool forward[MAX_VERTICES] = {false}, backward[MAX_VERTICES] = {false};
+    _sccReach(g, member, pivot, true, forward);
+    _sccReach(g, member, pivot, false, backward);
+
+    // Forward and Backward Sets meet exactly in the Pivot's Component, the other three Parts are independent
+    sccTask *forwardOnly = (sccTask *)malloc(sizeof(sccTask));
+    sccTask *backwardOnly = (sccTask *)malloc(sizeof(sccTask));
+    forwardOnly->count = 0;
+    backwardOnly->count = 0;
+    int remaining = 0;
+    int id = __atomic_fetch_add(&shared->nextComponent, 1, __ATOMIC_RELAXED);
+
+    for (int i = 0; i < task->count; i++)
+    {
+        int v = task->vertices[i];
+        if (!member[v])
+            continue;
+
+        if (forward[v] && backward[v])
+            shared->component[v] = id;
+        else if (forward[v])
+            forwardOnly->vertices[forwardOnly->count++] = v;
+        else if (backward[v])
+            backwardOnly->vertices[backwardOnly->count++] = v;
+        else
+            task->vertices[remaining++] = v;
+    }
+    task->count = remaining;
+
+    _sccPush(shared, forwardOnly);
+    _sccPush(shared, backwardOnly);
+    _sccPush(shared, task);
+}
+
+// Worker Loop, runs until no Task is queued or in flight
+static void _sccWorker(int index, int threadId, void *context)
+{
+    (void)index;
+    (void)threadId;
+    sccShared *shared = (sccShared *)context;
+
+    pthread_mutex_lock(&shared->lock);
+    while (1) {
+        while (shared->taskTop == 0 && shared->pending > 0)
+            pthread_cond_wait(&shared->changed, &shared->lock);
+        if (shared->taskTop == 0)
+            break;
+
+        sccTask *task = shared->tasks[--shared->taskTop];
+        pthread_mutex_unlock(&shared->lock);
+
+        _sccSplit(shared, task);
+
+        pthread_mutex_lock(&shared->lock);
+        if (--shared->pending == 0)
+            pthread_cond_broadcast(&shared->changed);
+    }
+    pthread_mutex_unlock(&shared->lock);
+}
+
+// Strongly Connected Components using Forward-Backward Splitting across threadCount Threads
+// Component IDs carry no Order, returns the Component Count
+int parallelStronglyConnectedComponents(Graph *g, int component[], int threadCount)
+{
+    if (g->n == 0)
+        return 0;
+
+    sccShared shared;
+    shared.g = g;
+    shared.component = component;
+    shared.nextComponent = 0;
+    shared.taskTop = 0;
+    shared.pending = 0;
+    pthread_mutex_init(&shared.lock, NULL);
+    pthread_cond_init(&shared.changed, NULL);
+
+    sccTask *all = (sccTask *)malloc(sizeof(sccTask));
+    all->count = g->n;
+    for (int i = 0; i < g->n; i++)
+        all->vertices[i] = i;
+    _sccPush(&shared, all);
+
+    parallelFor(threadCount, threadCount, _sccWorker, &shared);
+
+    pthread_cond_destroy(&shared.changed);
+    pthread_mutex_destroy(&shared.lock);
+    return shared.nextComponent;
+}
+//----------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------
+// Weakly Connected Components
+
+typedef struct wccShared_t {
+    Graph *g;   // Graph
+    int *parent; // Union-Find Parents
+} wccShared;
+
+// Union a Row's Edges into the Disjoint Set
+static void _wccRow(int u, int threadId, void *context)
+{
+    (void)threadId;
+    wccShared *shared = (wccShared *)context;
+
+    for (int v = 0; v < shared->g->n; v++)
+        if (shared->g->adj[u][v])
+            unionFindUnion(shared->parent, u, v);
+}
+
+// Weakly Connected Components using a Lock-Free Union-Find across threadCount Threads
+// Component IDs follow the lowest Vertex in each Component, returns the Component Count
+int weaklyConnectedComponents(Graph *g, int component[], int threadCount)
+{
+    int parent[MAX_VERTICES];
+    unionFindInit(parent, g->n);
+
+    wccShared shared = {g, parent};
+    parallelFor(g->n, threadCount, _wccRow, &shared);
+
+    return unionFindLabel(parent, g->n, component);
+}
+//----------------------------------------------------------------------------------
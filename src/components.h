@@ -0,0 +1,12 @@
+#ifndef _COMPONENTS_H_
+#define _COMPONENTS_H_
+
+#include <stdbool.h>
+
+#include "graph.h"
+
+int stronglyConnectedComponents(Graph *g, int component[]);
+int parallelStronglyConnectedComponents(Graph *g, int component[], int threadCount);
+int weaklyConnectedComponents(Graph *g, int component[], int threadCount);
+
+#endif
@@ -0,0 +1,183 @@
+#include "compressedGraph.h"
+
+#include <stdlib.h>
+#include <limits.h>
+
+#include "priorityQueue.h"
+
+// Append an unsigned Varint, 7 Bits per Byte with the high Bit marking a following Byte
+static size_t _putVarint(unsigned char *out, unsigned int value)
+{
+    size_t length = 0;
+    while (value >= 0x80) {
+        out[length++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    out[length++] = (unsigned char)value;
+    return length;
+}
+
+// Decode an unsigned Varint, advancing the Position past it
+static inline unsigned int _getVarint(const unsigned char **position)
+{
+    const unsigned char *p = *position;
+    unsigned int value = *p & 0x7F;
+    for (int shift = 7; *p++ & 0x80; shift += 7)
+        value |= (unsigned int)(*p & 0x7F) << shift;
+    *position = p;
+    return value;
+}
+
+// Initialize an empty Compressed Graph
+void compressedGraphInit(CompressedGraph *cg)
+{
+    cg->version = 0;
+    cg->n = 0;
+    cg->edges = 0;
+    cg->offset[0] = 0;
+    cg->bytes = NULL;
+    cg->size = 0;
+}
+
+// Free the Packed Lists
+void compressedGraphDeinit(CompressedGraph *cg)
+{
+    free(cg->bytes);
+    compressedGraphInit(cg);
+}
+
+// Pack the Adjacency Lists of g, returns the Number of Bytes used or -1 if they could not be allocated
+// Weights are stored ZigZag encoded so negative Weights stay small
+int compressGraph(Graph *g, CompressedGraph *cg)
+{
+    // Each Edge takes at most 5 Bytes of Gap and 5 of Weight
+    unsigned char *bytes = (unsigned char *)malloc((size_t)g->n * g->n * 10 + 1);
+    if (bytes == NULL)
+        return -1;
+
+    size_t size = 0;
+    cg->edges = 0;
+    for (int u = 0; u < g->n; u++)
+    {
+        int last = -1;
+        cg->offset[u] = (int)size;
+        for (int v = 0; v < g->n; v++)
+            if (g->adj[u][v])
+            {
+                int w = g->adj[u][v];
+                size += _putVarint(bytes + size, (unsigned int)(v - last - 1));
+                size += _putVarint(bytes + size, ((unsigned int)w << 1) ^ (unsigned int)(w >> 31));
+                last = v;
+                cg->edges++;
+            }
+    }
+    cg->offset[g->n] = (int)size;
+
+    free(cg->bytes);
+    cg->bytes = (unsigned char *)realloc(bytes, size + 1);
+    if (cg->bytes == NULL)
+        cg->bytes = bytes;
+    cg->size = size;
+    cg->n = g->n;
+    cg->version = g->version;
+    return (int)size;
+}
+
+// Total Bytes held by the Compressed Graph, Offsets included
+size_t compressedGraphBytes(CompressedGraph *cg)
+{
+    return cg->size + (size_t)(cg->n + 1) * sizeof(int);
+}
+
+// Start iterating over the Neighbours of u
+void neighbourBegin(CompressedGraph *cg, int u, NeighbourIterator *it)
+{
+    it->position = cg->bytes + cg->offset[u];
+    it->end = cg->bytes + cg->offset[u + 1];
+    it->vertex = -1;
+    it->weight = 0;
+}
+
+// Move to the next Neighbour in ascending Order, returns false once the List is exhausted
+bool neighbourNext(NeighbourIterator *it)
+{
+    if (it->position >= it->end)
+        return false;
+    it->vertex += (int)_getVarint(&it->position) + 1;
+    unsigned int zigzag = _getVarint(&it->position);
+    it->weight = (int)(zigzag >> 1) ^ -(int)(zigzag & 1);
+    return true;
+}
+
+// Breadth-First Search over the packed Lists recording Hop Distances (-1 if unreachable) and the Visit Order
+// Returns the Number of Vertices reached
+int compressedBfsDistances(CompressedGraph *cg, int u, int dist[], int order[])
+{
+    int front = 0, rear = 0;
+    NeighbourIterator it;
+
+    for (int i = 0; i < cg->n; i++)
+        dist[i] = -1;
+
+    dist[u] = 0;
+    order[rear++] = u;
+
+    while (front < rear) {
+        u = order[front++];
+
+        for (neighbourBegin(cg, u, &it); neighbourNext(&it); )
+            if (dist[it.vertex] == -1) {
+                dist[it.vertex] = dist[u] + 1;
+                order[rear++] = it.vertex;
+            }
+    }
+    return rear;
+}
+
+// Dijkstra's Algorithm over the packed Lists recording Distances (INT_MAX if unreachable), Parents and the Settle Order
+// Returns the Number of Vertices reached
+int compressedDjkDistances(CompressedGraph *cg, int u, int dist[], int prev[], int order[])
+{
+    priorityQueue verticesWithDistance;
+    bool queued[MAX_VERTICES];
+    int settled = 0;
+    NeighbourIterator it;
+
+    pQueueInit(&verticesWithDistance);
+    for (int i = 0; i < cg->n; i++)
+    {
+        dist[i] = INT_MAX;
+        prev[i] = -1;
+        queued[i] = false;
+    }
+
+    dist[u] = 0;
+    queued[u] = true;
+    pQueueInsert(&verticesWithDistance, u, 0);
+
+    while (verticesWithDistance.filled > 0)
+    {
+        u = pQueueExtractMin(&verticesWithDistance);
+        order[settled++] = u;
+
+        for (neighbourBegin(cg, u, &it); neighbourNext(&it); )
+        {
+            int v = it.vertex;
+            if (dist[v] > dist[u] + it.weight)
+            {
+                dist[v] = dist[u] + it.weight;
+                prev[v] = u;
+                if (queued[v])
+                    pQueueDecreaseKey(&verticesWithDistance, v, dist[v]);
+                else
+                {
+                    queued[v] = true;
+                    pQueueInsert(&verticesWithDistance, v, dist[v]);
+                }
+            }
+        }
+    }
+
+    pQueueDeinit(&verticesWithDistance);
+    return settled;
+}
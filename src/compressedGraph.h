@@ -0,0 +1,36 @@
+#ifndef _COMPRESSED_GRAPH_H_
+#define _COMPRESSED_GRAPH_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "graph.h"
+
+// Read-only Adjacency Lists packed as Varints: each Neighbour is the Gap from the previous one, then its Weight
+typedef struct compressedGraph_t {
+    unsigned int version;           // Graph Version the Lists were packed from (0 if never packed)
+    int n;                          // Number of Vertices
+    int edges;                      // Number of Edges
+    int offset[MAX_VERTICES + 1];   // Byte Offset of each Vertex's List
+    unsigned char *bytes;           // Packed Lists
+    size_t size;                    // Bytes used by the Packed Lists
+} CompressedGraph;
+
+// Position in a packed Adjacency List
+typedef struct neighbourIterator_t {
+    const unsigned char *position;  // Next Byte to decode
+    const unsigned char *end;       // End of the List
+    int vertex;                     // Current Neighbour
+    int weight;                     // Weight of the Edge to the current Neighbour
+} NeighbourIterator;
+
+void compressedGraphInit(CompressedGraph *cg);
+void compressedGraphDeinit(CompressedGraph *cg);
+int compressGraph(Graph *g, CompressedGraph *cg);
+size_t compressedGraphBytes(CompressedGraph *cg);
+void neighbourBegin(CompressedGraph *cg, int u, NeighbourIterator *it);
+bool neighbourNext(NeighbourIterator *it);
+int compressedBfsDistances(CompressedGraph *cg, int u, int dist[], int order[]);
+int compressedDjkDistances(CompressedGraph *cg, int u, int dist[], int prev[], int order[]);
+
+#endif
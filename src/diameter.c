@@ -0,0 +1,282 @@
+#include "diameter.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "parallel.h"
+
+#define DIAMETER_WORDS ((MAX_VERTICES + 63) / 64)
+
+typedef struct diameterShared_t {
+    int n;                                            // Number of Vertices
+    uint64_t neighbours[MAX_VERTICES][DIAMETER_WORDS]; // Undirected Neighbour Set of each Vertex
+    int batch[MAX_VERTICES];                          // Sources of the current Batch of Searches
+    int dist[MAX_VERTICES][MAX_VERTICES];             // Distances from each Source of the Batch
+    int ecc[MAX_VERTICES];                            // Eccentricity of each Source of the Batch
+    EccentricityResult *result;                       // Result
+} diameterShared;
+
+// Level-synchronous Breadth-First Search over Bitsets, returns the Eccentricity of u
+// dist is -1 outside u's Component, parent (if given) is -1 for u and unreached Vertices
+static int _bfsLevels(diameterShared *shared, int u, int dist[], int parent[])
+{
+    uint64_t visited[DIAMETER_WORDS] = {0}, frontier[DIAMETER_WORDS] = {0}, next[DIAMETER_WORDS];
+    int level = 0;
+
+    for (int v = 0; v < shared->n; v++)
+    {
+        dist[v] = -1;
+        if (parent)
+            parent[v] = -1;
+    }
+    dist[u] = 0;
+    visited[u / 64] = frontier[u / 64] = 1ULL << (u % 64);
+
+    while (1) {
+        bool any = false;
+        for (int w = 0; w < DIAMETER_WORDS; w++)
+            next[w] = 0;
+        for (int fw = 0; fw < DIAMETER_WORDS; fw++)
+            for (uint64_t bits = frontier[fw]; bits; bits &= bits - 1)
+            {
+                int v = fw * 64 + __builtin_ctzll(bits);
+                for (int w = 0; w < DIAMETER_WORDS; w++)
+                    next[w] |= shared->neighbours[v][w];
+            }
+        for (int w = 0; w < DIAMETER_WORDS; w++)
+        {
+            next[w] &= ~visited[w];
+            visited[w] |= next[w];
+            any |= (next[w] != 0);
+        }
+        if (!any)
+            return level;
+
+        level++;
+        for (int nw = 0; nw < DIAMETER_WORDS; nw++)
+            for (uint64_t bits = next[nw]; bits; bits &= bits - 1)
+            {
+                int v = nw * 64 + __builtin_ctzll(bits);
+                dist[v] = level;
+                if (parent)
+                    for (int fw = 0; fw < DIAMETER_WORDS && parent[v] == -1; fw++)
+                        if (shared->neighbours[v][fw] & frontier[fw])
+                            parent[v] = fw * 64 + __builtin_ctzll(shared->neighbours[v][fw] & frontier[fw]);
+            }
+        for (int w = 0; w < DIAMETER_WORDS; w++)
+            frontier[w] = next[w];
+    }
+}
+
+// Tighten Eccentricity Bounds with the Distances from a Source of known Eccentricity
+static void _tighten(diameterShared *shared, int source, int ecc, int dist[])
+{
+    EccentricityResult *result = shared->result;
+
+    result->bfsRuns++;
+    result->eccLower[source] = result->eccUpper[source] = ecc;
+    for (int v = 0; v < shared->n; v++)
+    {
+        if (dist[v] < 0)
+            continue;
+        int lower = (dist[v] > ecc - dist[v]) ? dist[v] : ecc - dist[v];
+        if (lower > result->eccLower[v])
+            result->eccLower[v] = lower;
+        if (ecc + dist[v] < result->eccUpper[v])
+            result->eccUpper[v] = ecc + dist[v];
+    }
+}
+
+// Search from one Source of the current Batch
+static void _batchSearch(int index, int threadId, void *context)
+{
+    (void)threadId;
+    diameterShared *shared = (diameterShared *)context;
+    shared->ecc[index] = _bfsLevels(shared, shared->batch[index], shared->dist[index], NULL);
+}
+
+// Search from every Source of the current Batch across threadCount Threads, returns the largest Eccentricity found
+static int _runBatch(diameterShared *shared, int count, int threadCount)
+{
+    int largest = 0;
+
+    parallelFor(count, threadCount, _batchSearch, shared);
+    for (int i = 0; i < count; i++)
+    {
+        _tighten(shared, shared->batch[i], shared->ecc[i], shared->dist[i]);
+        if (shared->ecc[i] > largest)
+            largest = shared->ecc[i];
+    }
+    return largest;
+}
+
+// Initialize an empty Eccentricity Result
+void eccentricityInit(EccentricityResult *result)
+{
+    result->version = 0;
+    result->n = 0;
+    result->diameter = 0;
+    result->radius = 0;
+    result->peripheral = -1;
+    result->center = -1;
+    result->bfsRuns = 0;
+    result->seconds = 0.0;
+}
+
+// Exact Diameter and Radius by iFUB with Double-Sweep Lower Bounds, returns the Diameter
+// Each Component is swept twice from its highest Degree Vertex, then iFUB searches from the Fringes of the Sweep's
+// Midpoint, one Fringe per parallel Batch, until the Bounds meet; the Radius is then settled by searching from
+// the Vertices with the smallest Lower Bounds, and every Search tightens the Bounds of all Vertices it reaches
+int graphDiameter(Graph *g, int threadCount, EccentricityResult *result)
+{
+    diameterShared *shared = (diameterShared *)malloc(sizeof(diameterShared));
+    int n = g->n, degree[MAX_VERTICES], component[MAX_VERTICES];
+    int dist[MAX_VERTICES], parent[MAX_VERTICES];
+    double start = parallelTime();
+
+    shared->n = n;
+    shared->result = result;
+    result->n = n;
+    result->bfsRuns = 0;
+    for (int u = 0; u < n; u++)
+    {
+        degree[u] = 0;
+        component[u] = -1;
+        result->eccLower[u] = 0;
+        result->eccUpper[u] = n;
+        for (int w = 0; w < DIAMETER_WORDS; w++)
+            shared->neighbours[u][w] = 0;
+    }
+    for (int u = 0; u < n; u++)
+        for (int v = 0; v < n; v++)
+            if (u != v && (g->adj[u][v] || g->adj[v][u]))
+            {
+                shared->neighbours[u][v / 64] |= 1ULL << (v % 64);
+                degree[u]++;
+            }
+
+    for (int c = 0; c < n; c++)
+    {
+        if (component[c] != -1)
+            continue;
+        if (degree[c] == 0)
+        {
+            component[c] = c;
+            result->eccLower[c] = result->eccUpper[c] = 0;
+            continue;
+        }
+
+        // Label the Component and find its highest Degree Vertex
+        int r = c;
+        _tighten(shared, c, _bfsLevels(shared, c, dist, NULL), dist);
+        for (int v = 0; v < n; v++)
+            if (dist[v] >= 0)
+            {
+                component[v] = c;
+                if (degree[v] > degree[r])
+                    r = v;
+            }
+
+        // Double Sweep r -> a -> b, the a-b Distance bounds the Diameter from below
+        int ecc = _bfsLevels(shared, r, dist, NULL), a = r;
+        _tighten(shared, r, ecc, dist);
+        for (int v = 0; v < n; v++)
+            if (dist[v] > dist[a])
+                a = v;
+        int lower = _bfsLevels(shared, a, dist, parent), b = a;
+        _tighten(shared, a, lower, dist);
+        for (int v = 0; v < n; v++)
+            if (dist[v] > dist[b])
+                b = v;
+
+        // iFUB from the Midpoint of the a-b Path
+        int u = b;
+        for (int steps = 0; steps < lower / 2; steps++)
+            u = parent[u];
+        int level = _bfsLevels(shared, u, dist, NULL);
+        _tighten(shared, u, level, dist);
+        if (level > lower)
+            lower = level;
+        int upper = 2 * level;
+
+        while (upper > lower && level > 0) {
+            int count = 0;
+            for (int v = 0; v < n; v++)
+                if (dist[v] == level && result->eccLower[v] != result->eccUpper[v])
+                    shared->batch[count++] = v;
+            for (int v = 0; v < n; v++)
+                if (dist[v] == level && result->eccLower[v] == result->eccUpper[v] && result->eccLower[v] > lower)
+                    lower = result->eccLower[v];
+
+            // Fringe Searches overwrite the Batch Distances, not the Distances from u
+            int fringe = _runBatch(shared, count, threadCount);
+            if (fringe > lower)
+                lower = fringe;
+            if (lower > 2 * (level - 1))
+                break;
+            upper = 2 * (level - 1);
+            level--;
+        }
+    }
+
+    // Settle the Radius: search from the smallest unsettled Lower Bounds until no Lower Bound undercuts the best Upper Bound
+    while (1) {
+        int bestUpper = n, count = 0;
+        for (int v = 0; v < n; v++)
+            if (degree[v] > 0 && result->eccUpper[v] < bestUpper)
+                bestUpper = result->eccUpper[v];
+
+        int candidates[MAX_VERTICES], candidateCount = 0;
+        for (int v = 0; v < n; v++)
+            if (degree[v] > 0 && result->eccLower[v] < bestUpper && result->eccLower[v] != result->eccUpper[v])
+                candidates[candidateCount++] = v;
+        if (candidateCount == 0)
+            break;
+
+        int batchSize = (threadCount < 1) ? 1 : threadCount;
+        while (count < batchSize && count < candidateCount) {
+            int best = count;
+            for (int i = count + 1; i < candidateCount; i++)
+                if (result->eccLower[candidates[i]] < result->eccLower[candidates[best]])
+                    best = i;
+            int chosen = candidates[best];
+            candidates[best] = candidates[count];
+            shared->batch[count++] = chosen;
+        }
+        _runBatch(shared, count, threadCount);
+    }
+
+    result->diameter = 0;
+    result->radius = 0;
+    result->peripheral = -1;
+    result->center = -1;
+    for (int v = 0; v < n; v++)
+    {
+        if (result->peripheral == -1 || result->eccLower[v] > result->diameter)
+        {
+            result->diameter = result->eccLower[v];
+            result->peripheral = v;
+        }
+        if (degree[v] > 0 && (result->center == -1 || result->eccUpper[v] < result->radius))
+        {
+            result->radius = result->eccUpper[v];
+            result->center = v;
+        }
+    }
+
+    result->seconds = parallelTime() - start;
+    result->version = g->version;
+    free(shared);
+    return result->diameter;
+}
+
+// Print the Diameter, Radius and Searches needed
+void diameterReport(Graph *g, EccentricityResult *result)
+{
+    printf("Diameter: %d (%s), Radius: %d (%s)\n", result->diameter,
+        (result->peripheral != -1) ? g->labels[result->peripheral] : "-", result->radius,
+        (result->center != -1) ? g->labels[result->center] : "-");
+    printf("  %d Breadth-First Searches instead of %d, %.3f ms\n", result->bfsRuns, result->n, result->seconds * 1000.0);
+}
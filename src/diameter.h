@@ -0,0 +1,25 @@
+#ifndef _DIAMETER_H_
+#define _DIAMETER_H_
+
+#include "graph.h"
+
+// Diameter, Radius and Eccentricity Bounds in Hops, Edges taken as undirected
+// Eccentricities are taken within each Vertex's Component
+typedef struct eccentricityResult_t {
+    unsigned int version;          // Graph Version the Bounds were computed for (0 if never computed)
+    int n;                         // Number of Vertices
+    int diameter;                  // Largest Eccentricity
+    int radius;                    // Smallest Eccentricity among Vertices with Neighbours
+    int peripheral;                // A Vertex whose Eccentricity is the Diameter
+    int center;                    // A Vertex whose Eccentricity is the Radius
+    int eccLower[MAX_VERTICES];    // Lower Bound on the Eccentricity of each Vertex
+    int eccUpper[MAX_VERTICES];    // Upper Bound on the Eccentricity of each Vertex
+    int bfsRuns;                   // Breadth-First Searches needed, against n for the naive Approach
+    double seconds;                // Time taken
+} EccentricityResult;
+
+void eccentricityInit(EccentricityResult *result);
+int graphDiameter(Graph *g, int threadCount, EccentricityResult *result);
+void diameterReport(Graph *g, EccentricityResult *result);
+
+#endif
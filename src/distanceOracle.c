@@ -0,0 +1,399 @@
+#include "distanceOracle.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
+
+#include "parallel.h"
+
+#define ORACLE_MAGIC 0x315A544FU // "OTZ1"
+
+typedef struct oracleShared_t {
+    int n;                                            // Number of Vertices
+    int weight[MAX_VERTICES][MAX_VERTICES];           // Undirected Edge Weights (0 if none)
+    int level[MAX_VERTICES];                          // Highest Level whose Landmarks include each Vertex
+    int bound[MAX_VERTICES];                          // Distance to the next Level's Landmarks while building a Cluster
+    int clusterDistance[MAX_VERTICES][MAX_VERTICES];  // Distance from each Vertex to each Cluster Centre (-1 if outside)
+    int clusterNext[MAX_VERTICES][MAX_VERTICES];      // Next Vertex towards each Cluster Centre
+    DistanceOracle *oracle;                           // Oracle being built
+} oracleShared;
+
+// Xorshift Generator local to one Build, so Sampling neither reads nor reseeds the Process-wide rand() State
+typedef struct oracleRandom_t {
+    uint32_t state; // Current State, never 0
+} oracleRandom;
+
+// Seed the Generator, mixing the Seed so nearby Seeds start far apart
+static void _randomSeed(oracleRandom *random, unsigned int seed)
+{
+    random->state = (uint32_t)seed * 0x9E3779B9U + 0x7F4A7C15U;
+    if (random->state == 0)
+        random->state = 1;
+}
+
+// Next Value of the Generator as a Fraction in [0, 1)
+static double _randomFraction(oracleRandom *random)
+{
+    uint32_t x = random->state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    random->state = x;
+    return x / 4294967296.0;
+}
+
+// Dijkstra's Algorithm from a Set of Sources, optionally only settling Vertices closer than their Bound
+// Sources have dist 0 on entry, everything else INT_MAX; root and next describe the Shortest-Path Forest
+static void _dijkstraFrom(oracleShared *shared, int dist[], int root[], int next[], const int bound[])
+{
+    bool done[MAX_VERTICES] = {false};
+
+    while (1) {
+        int u = -1;
+        for (int i = 0; i < shared->n; i++)
+            if (!done[i] && dist[i] != INT_MAX && (u == -1 || dist[i] < dist[u]))
+                u = i;
+        if (u == -1)
+            return;
+        done[u] = true;
+
+        for (int v = 0; v < shared->n; v++)
+        {
+            int w = shared->weight[u][v];
+            if (w == 0 || done[v] || dist[u] + w >= dist[v] || (bound && dist[u] + w >= bound[v]))
+                continue;
+            dist[v] = dist[u] + w;
+            root[v] = root[u];
+            next[v] = u;
+        }
+    }
+}
+
+// Grow the Cluster of one Landmark: every Vertex closer to it than to any Landmark of the next Level
+static void _growCluster(int w, int threadId, void *context)
+{
+    (void)threadId;
+    oracleShared *shared = (oracleShared *)context;
+    int dist[MAX_VERTICES], root[MAX_VERTICES], next[MAX_VERTICES];
+    int *bound = NULL;
+    if (shared->level[w] + 1 < shared->oracle->k)
+        bound = shared->oracle->pivotDistance[shared->level[w] + 1];
+
+    for (int v = 0; v < shared->n; v++)
+    {
+        dist[v] = INT_MAX;
+        next[v] = -1;
+    }
+    dist[w] = 0;
+    root[w] = w;
+    _dijkstraFrom(shared, dist, root, next, bound);
+
+    for (int v = 0; v < shared->n; v++)
+        if (dist[v] != INT_MAX)
+        {
+            shared->clusterDistance[v][w] = dist[v];
+            shared->clusterNext[v][w] = next[v];
+        }
+}
+
+// Position of w's Entry in v's Bunch, or -1 if w is not a Member
+static int _bunchEntry(DistanceOracle *oracle, int v, int w)
+{
+    if (!(oracle->bunch[v][w / 64] & (1ULL << (w % 64))))
+        return -1;
+    int rank = oracle->bunchStart[v];
+    for (int i = 0; i < w / 64; i++)
+        rank += __builtin_popcountll(oracle->bunch[v][i]);
+    return rank + __builtin_popcountll(oracle->bunch[v][w / 64] & ((1ULL << (w % 64)) - 1));
+}
+
+// Check an Oracle read from a File before it is used
+// Pivots and Next Vertices must be in range, each Pivot must be in its Vertex's Bunch at its stored Distance,
+// and each Next Vertex must be strictly closer to the Centre, so every Walk ends at the Centre within n Steps
+static bool _oracleValid(DistanceOracle *oracle, int n, int k)
+{
+    for (int w = n; w < ORACLE_WORDS * 64; w++)
+        for (int v = 0; v < n; v++)
+            if (oracle->bunch[v][w / 64] & (1ULL << (w % 64)))
+                return false;
+
+    for (int v = 0; v < n; v++)
+        for (int w = 0; w < n; w++)
+        {
+            int entry = _bunchEntry(oracle, v, w);
+            if (entry == -1)
+                continue;
+            int x = oracle->next[entry], d = oracle->distance[entry];
+            if (w == v)
+            {
+                if (x != -1 || d != 0)
+                    return false;
+                continue;
+            }
+            if (x < 0 || x >= n || d <= 0)
+                return false;
+            int closer = _bunchEntry(oracle, x, w);
+            if (closer == -1 || oracle->distance[closer] >= d)
+                return false;
+        }
+
+    for (int i = 0; i < k; i++)
+        for (int v = 0; v < n; v++)
+        {
+            int w = oracle->pivot[i][v];
+            if (w < -1 || w >= n || (i == 0 && w != v))
+                return false;
+            if (w == -1)
+            {
+                if (oracle->pivotDistance[i][v] != INT_MAX)
+                    return false;
+                continue;
+            }
+            int entry = _bunchEntry(oracle, v, w);
+            if (entry == -1 || oracle->distance[entry] != oracle->pivotDistance[i][v])
+                return false;
+        }
+    return true;
+}
+
+// Initialize an empty Distance Oracle
+void oracleInit(DistanceOracle *oracle)
+{
+    oracle->version = 0;
+    oracle->n = 0;
+    oracle->k = 0;
+    oracle->entries = 0;
+}
+
+// Build a Distance Oracle with k Levels of Landmarks sampled from seed, Clusters grown across threadCount Threads
+// Returns the Number of stored Distances
+int buildDistanceOracle(Graph *g, int k, unsigned int seed, int threadCount, DistanceOracle *oracle)
+{
+    oracleShared *shared = (oracleShared *)malloc(sizeof(oracleShared));
+    int n = g->n;
+
+    if (k < 1)
+        k = 1;
+    if (k > ORACLE_MAX_LEVELS)
+        k = ORACLE_MAX_LEVELS;
+    shared->n = n;
+    shared->oracle = oracle;
+    oracle->n = n;
+    oracle->k = k;
+
+    for (int u = 0; u < n; u++)
+        for (int v = 0; v < n; v++)
+        {
+            int forward = (u != v && g->adj[u][v] > 0) ? g->adj[u][v] : 0;
+            int backward = (u != v && g->adj[v][u] > 0) ? g->adj[v][u] : 0;
+            shared->weight[u][v] = (forward && backward) ? (forward < backward ? forward : backward) : forward + backward;
+            shared->clusterDistance[u][v] = -1;
+        }
+
+    // Sample Landmarks, each Level keeping a Vertex of the previous one with Probability n^(-1/k)
+    // The top Level always keeps at least one Vertex
+    oracleRandom random;
+    _randomSeed(&random, seed);
+    double keep = (n > 1) ? pow((double)n, -1.0 / k) : 1.0;
+    for (int v = 0; v < n; v++)
+        shared->level[v] = 0;
+    for (int i = 1; i < k; i++)
+    {
+        int kept = -1;
+        for (int v = 0; v < n; v++)
+            if (shared->level[v] == i - 1 && _randomFraction(&random) < keep)
+            {
+                shared->level[v] = i;
+                kept = v;
+            }
+        if (kept == -1)
+            for (int v = 0; v < n && kept == -1; v++)
+                if (shared->level[v] == i - 1)
+                {
+                    shared->level[v] = i;
+                    kept = v;
+                }
+    }
+
+    // Nearest Landmark of every Level from one multi-source Search per Level
+    int pivotNext[ORACLE_MAX_LEVELS][MAX_VERTICES];
+    for (int i = 0; i < k; i++)
+    {
+        for (int v = 0; v < n; v++)
+        {
+            oracle->pivotDistance[i][v] = (shared->level[v] >= i) ? 0 : INT_MAX;
+            oracle->pivot[i][v] = (shared->level[v] >= i) ? v : -1;
+            pivotNext[i][v] = -1;
+        }
+        _dijkstraFrom(shared, oracle->pivotDistance[i], oracle->pivot[i], pivotNext[i], NULL);
+    }
+
+    // Clusters of all Landmarks are independent
+    parallelFor(n, threadCount, _growCluster, shared);
+
+    // Bunches are the Clusters turned inside out, plus every Vertex's own Pivots so Paths can be walked both ways
+    for (int v = 0; v < n; v++)
+        for (int i = 0; i < k; i++)
+        {
+            int w = oracle->pivot[i][v];
+            if (w != -1 && shared->clusterDistance[v][w] == -1)
+            {
+                shared->clusterDistance[v][w] = oracle->pivotDistance[i][v];
+                shared->clusterNext[v][w] = pivotNext[i][v];
+            }
+        }
+
+    oracle->entries = 0;
+    for (int v = 0; v < n; v++)
+    {
+        oracle->bunchStart[v] = oracle->entries;
+        for (int i = 0; i < ORACLE_WORDS; i++)
+            oracle->bunch[v][i] = 0;
+        for (int w = 0; w < n; w++)
+            if (shared->clusterDistance[v][w] != -1)
+            {
+                oracle->bunch[v][w / 64] |= 1ULL << (w % 64);
+                oracle->distance[oracle->entries] = shared->clusterDistance[v][w];
+                oracle->next[oracle->entries] = shared->clusterNext[v][w];
+                oracle->entries++;
+            }
+    }
+    oracle->bunchStart[n] = oracle->entries;
+
+    oracle->version = g->version;
+    free(shared);
+    return oracle->entries;
+}
+
+// Approximate Distance between u and v (INT_MAX if they are not connected), at most 2k - 1 times the true Distance
+// If path is given, it receives the Vertices of a Walk of that Length from u to v and hops their Count
+// The Walk goes through a Centre and may repeat Vertices, so it can take up to ORACLE_MAX_PATH Entries
+// Returns -1 if it does not fit in capacity Entries
+int oracleDistance(DistanceOracle *oracle, int u, int v, int path[], int capacity, int *hops)
+{
+    int a = u, b = v, w = u, level = 0;
+
+    while (_bunchEntry(oracle, b, w) == -1) {
+        if (++level >= oracle->k)
+            return INT_MAX;
+        int swap = a;
+        a = b;
+        b = swap;
+        w = oracle->pivot[level][a];
+        if (w == -1)
+            return INT_MAX;
+    }
+
+    if (path)
+    {
+        // Walk from u down to the Centre w, then back up to v
+        int count = 0, tail[MAX_VERTICES], tailCount = 0;
+        for (int x = u; x != -1; x = (x == w) ? -1 : oracle->next[_bunchEntry(oracle, x, w)])
+        {
+            if (count == capacity)
+                return -1;
+            path[count++] = x;
+        }
+        for (int x = v; x != w; x = oracle->next[_bunchEntry(oracle, x, w)])
+            tail[tailCount++] = x;
+        if (count + tailCount > capacity)
+            return -1;
+        while (tailCount > 0)
+            path[count++] = tail[--tailCount];
+        *hops = count;
+    }
+
+    return oracle->distance[_bunchEntry(oracle, a, w)] + oracle->distance[_bunchEntry(oracle, b, w)];
+}
+
+// Write the Oracle to a File, returns 0 on Success and -1 on Failure
+int oracleSave(DistanceOracle *oracle, const char *filename)
+{
+    FILE *fp = fopen(filename, "wb");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "Error: %s\n", strerror(errno));
+        return -1;
+    }
+
+    unsigned int magic = ORACLE_MAGIC;
+    int n = oracle->n, k = oracle->k;
+    bool ok = fwrite(&magic, sizeof(magic), 1, fp) == 1 &&
+              fwrite(&n, sizeof(n), 1, fp) == 1 &&
+              fwrite(&k, sizeof(k), 1, fp) == 1 &&
+              fwrite(&oracle->entries, sizeof(int), 1, fp) == 1;
+    for (int i = 0; i < k && ok; i++)
+        ok = fwrite(oracle->pivot[i], sizeof(int), n, fp) == (size_t)n &&
+             fwrite(oracle->pivotDistance[i], sizeof(int), n, fp) == (size_t)n;
+    for (int v = 0; v < n && ok; v++)
+        ok = fwrite(oracle->bunch[v], sizeof(uint64_t), ORACLE_WORDS, fp) == ORACLE_WORDS;
+    ok = ok && fwrite(oracle->distance, sizeof(int), oracle->entries, fp) == (size_t)oracle->entries &&
+         fwrite(oracle->next, sizeof(int), oracle->entries, fp) == (size_t)oracle->entries;
+
+    if (fclose(fp) != 0 || !ok)
+    {
+        fprintf(stderr, "Error: Could not write %s\n", filename);
+        return -1;
+    }
+    return 0;
+}
+
+// Read an Oracle written by oracleSave, returns 0 on Success and -1 on Failure
+// The loaded Oracle is not tied to any Graph Version
+int oracleLoad(DistanceOracle *oracle, const char *filename)
+{
+    FILE *fp = fopen(filename, "rb");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "Error: %s\n", strerror(errno));
+        return -1;
+    }
+
+    unsigned int magic = 0;
+    int n = 0, k = 0, entries = 0;
+    bool ok = fread(&magic, sizeof(magic), 1, fp) == 1 && magic == ORACLE_MAGIC &&
+              fread(&n, sizeof(n), 1, fp) == 1 && n >= 0 && n <= MAX_VERTICES &&
+              fread(&k, sizeof(k), 1, fp) == 1 && k >= 1 && k <= ORACLE_MAX_LEVELS &&
+              fread(&entries, sizeof(entries), 1, fp) == 1 && entries >= 0 && entries <= n * n;
+    for (int i = 0; i < k && ok; i++)
+        ok = fread(oracle->pivot[i], sizeof(int), n, fp) == (size_t)n &&
+             fread(oracle->pivotDistance[i], sizeof(int), n, fp) == (size_t)n;
+    for (int v = 0; v < n && ok; v++)
+        ok = fread(oracle->bunch[v], sizeof(uint64_t), ORACLE_WORDS, fp) == ORACLE_WORDS;
+    ok = ok && fread(oracle->distance, sizeof(int), entries, fp) == (size_t)entries &&
+         fread(oracle->next, sizeof(int), entries, fp) == (size_t)entries;
+    fclose(fp);
+
+    if (!ok)
+    {
+        fprintf(stderr, "Error: %s is not a Distance Oracle\n", filename);
+        oracleInit(oracle);
+        return -1;
+    }
+
+    // Bunch Offsets follow from the Bitsets
+    int total = 0;
+    for (int v = 0; v < n; v++)
+    {
+        oracle->bunchStart[v] = total;
+        for (int i = 0; i < ORACLE_WORDS; i++)
+            total += __builtin_popcountll(oracle->bunch[v][i]);
+    }
+    oracle->bunchStart[n] = total;
+    if (total != entries || !_oracleValid(oracle, n, k))
+    {
+        fprintf(stderr, "Error: %s is not a Distance Oracle\n", filename);
+        oracleInit(oracle);
+        return -1;
+    }
+
+    oracle->version = 0;
+    oracle->n = n;
+    oracle->k = k;
+    oracle->entries = entries;
+    return 0;
+}
@@ -0,0 +1,33 @@
+#ifndef _DISTANCE_ORACLE_H_
+#define _DISTANCE_ORACLE_H_
+
+#include <stdint.h>
+
+#include "graph.h"
+
+#define ORACLE_MAX_LEVELS 8
+#define ORACLE_WORDS ((MAX_VERTICES + 63) / 64)
+#define ORACLE_MAX_PATH (2 * MAX_VERTICES - 1)
+
+// Thorup-Zwick Distance Oracle, answers within a Stretch of 2k - 1 using about k n^(1 + 1/k) stored Distances
+// Edges are taken as undirected, with the lighter Weight where both Directions exist
+typedef struct distanceOracle_t {
+    unsigned int version;                               // Graph Version the Oracle was built for (0 if never built)
+    int n;                                              // Number of Vertices
+    int k;                                              // Number of Levels
+    int pivot[ORACLE_MAX_LEVELS][MAX_VERTICES];         // Nearest Level i Landmark of each Vertex (-1 if none is reachable)
+    int pivotDistance[ORACLE_MAX_LEVELS][MAX_VERTICES]; // Distance to that Landmark
+    uint64_t bunch[MAX_VERTICES][ORACLE_WORDS];         // Bunch of each Vertex as a Bitset
+    int bunchStart[MAX_VERTICES + 1];                   // First Entry of each Bunch, Entries follow the Bitset Order
+    int distance[MAX_VERTICES * MAX_VERTICES];          // Distance from the Vertex to each Bunch Member
+    int next[MAX_VERTICES * MAX_VERTICES];              // Next Vertex on a shortest Path to each Bunch Member
+    int entries;                                        // Total Bunch Entries, against n * n for a full Table
+} DistanceOracle;
+
+void oracleInit(DistanceOracle *oracle);
+int buildDistanceOracle(Graph *g, int k, unsigned int seed, int threadCount, DistanceOracle *oracle);
+int oracleDistance(DistanceOracle *oracle, int u, int v, int path[], int capacity, int *hops);
+int oracleSave(DistanceOracle *oracle, const char *filename);
+int oracleLoad(DistanceOracle *oracle, const char *filename);
+
+#endif
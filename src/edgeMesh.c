@@ -0,0 +1,196 @@
+#include "edgeMesh.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "rlgl.h"
+
+// Append a Triangle, ordered the same Way as the Corners drawArrow passes to DrawTriangle
+static void _emitTriangle(EdgeMesh *mesh, Vector2 a, Vector2 b, Vector2 c)
+{
+    Vector2 *out = mesh->vertices + 3 * mesh->triangleCount++;
+    float cross = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    out[0] = a;
+    out[1] = (cross > 0) ? c : b;
+    out[2] = (cross > 0) ? b : c;
+}
+
+// Make Room for count more Triangles in the current Batch, starting a new one when the Chunk is full
+static void _reserveTriangles(int *submitted, int count, Color color)
+{
+    if (*submitted + count <= EDGE_MESH_CHUNK_TRIANGLES)
+    {
+        *submitted += count;
+        return;
+    }
+    rlEnd();
+    rlCheckRenderBatchLimit(3 * EDGE_MESH_CHUNK_TRIANGLES);
+    rlBegin(RL_TRIANGLES);
+    rlColor4ub(color.r, color.g, color.b, color.a);
+    *submitted = count;
+}
+
+// Order Screen Cells by their packed Coordinates
+static int _compareCells(const void *a, const void *b)
+{
+    long long x = *(const long long *)a, y = *(const long long *)b;
+    return (x > y) - (x < y);
+}
+
+// Check if the Inputs differ from those the Geometry was built for
+static bool _edgeMeshStale(EdgeMesh *mesh, Graph *g, Vector2 *points, int pointCount, bool hidden[], float thickness)
+{
+    return mesh->version != g->version || mesh->pointCount != pointCount || mesh->thickness != thickness ||
+           memcmp(mesh->points, points, pointCount * sizeof(Vector2)) != 0 ||
+           memcmp(mesh->hidden, hidden, pointCount * sizeof(bool)) != 0;
+}
+
+// Initialize an empty Edge Mesh
+void edgeMeshInit(EdgeMesh *mesh)
+{
+    mesh->version = 0;
+    mesh->pointCount = 0;
+    mesh->thickness = 0.0f;
+    mesh->triangleCount = 0;
+    mesh->labelCount = 0;
+    mesh->rebuilds = 0;
+    mesh->drawnEdges = 0;
+    mesh->mergedCells = 0;
+    mesh->cells = (long long *)malloc(MAX_VERTICES * MAX_VERTICES * sizeof(long long));
+    mesh->vertices = (Vector2 *)malloc(EDGE_MESH_MAX_TRIANGLES * 3 * sizeof(Vector2));
+    mesh->labelPositions = (Vector2 *)malloc(MAX_VERTICES * MAX_VERTICES * sizeof(Vector2));
+    mesh->labels = malloc(MAX_VERTICES * MAX_VERTICES * sizeof(*mesh->labels));
+}
+
+// Free the Geometry
+void edgeMeshDeinit(EdgeMesh *mesh)
+{
+    free(mesh->vertices);
+    free(mesh->labelPositions);
+    free(mesh->labels);
+    free(mesh->cells);
+    mesh->vertices = NULL;
+    mesh->cells = NULL;
+    mesh->labelPositions = NULL;
+    mesh->labels = NULL;
+    mesh->version = 0;
+}
+
+// Rebuild the Geometry if anything it depends on changed, returns true if it was rebuilt
+// Each Edge becomes a Quad of two Triangles followed by the Arrowhead drawArrow would draw
+bool edgeMeshUpdate(EdgeMesh *mesh, Graph *g, Vector2 *points, int pointCount, bool hidden[], float thickness)
+{
+    if (!_edgeMeshStale(mesh, g, points, pointCount, hidden, thickness))
+        return false;
+
+    mesh->triangleCount = 0;
+    mesh->labelCount = 0;
+    for (int e = 0; e < MAX_VERTICES * MAX_VERTICES; e++)
+        mesh->edgeTriangle[e] = mesh->edgeLabel[e] = -1;
+    for (int i = 0; i < pointCount; i++)
+        for (int j = 0; j < pointCount; j++)
+        {
+            if (g->adj[i][j] < 1 || hidden[i] || hidden[j])
+                continue;
+
+            Vector2 a = points[i], b = points[j];
+            float dx = b.x - a.x, dy = b.y - a.y, length = sqrtf(dx * dx + dy * dy);
+
+            // Line Quad
+            if (length > 0.0f)
+            {
+                float nx = -dy / length * thickness / 2, ny = dx / length * thickness / 2;
+                Vector2 a1 = {a.x + nx, a.y + ny}, a2 = {a.x - nx, a.y - ny};
+                Vector2 b1 = {b.x + nx, b.y + ny}, b2 = {b.x - nx, b.y - ny};
+                mesh->edgeTriangle[i * MAX_VERTICES + j] = mesh->triangleCount;
+                _emitTriangle(mesh, a1, a2, b1);
+                _emitTriangle(mesh, a2, b2, b1);
+
+                // Arrowhead
+                float c = dx / length, s = dy / length;
+                Vector2 tip = {b.x - 22 * c, b.y - 22 * s};
+                Vector2 base = {tip.x - 22 * c, tip.y - 22 * s};
+                float side1 = tip.x - a.x, side2 = tip.y - a.y;
+                _emitTriangle(mesh, (Vector2){base.x + side2 / 24, base.y - side1 / 24}, (Vector2){base.x - side2 / 24, base.y + side1 / 24}, tip);
+            }
+
+            // Weight Label
+            mesh->edgeLabel[i * MAX_VERTICES + j] = mesh->labelCount;
+            mesh->labelPositions[mesh->labelCount] = (Vector2){(a.x + b.x) / 2, (a.y + b.y) / 2 + 20};
+            snprintf(mesh->labels[mesh->labelCount++], sizeof(mesh->labels[0]), "%d", g->adj[i][j]);
+        }
+
+    mesh->version = g->version;
+    mesh->pointCount = pointCount;
+    mesh->thickness = thickness;
+    memcpy(mesh->points, points, pointCount * sizeof(Vector2));
+    memcpy(mesh->hidden, hidden, pointCount * sizeof(bool));
+    mesh->rebuilds++;
+    return true;
+}
+
+// Submit the cached Triangles of the given Edges in a few large Batches, then their Weight Labels
+// Below the Detail Zoom Arrowheads and Weight Labels are dropped, and Edges shorter than a few Pixels on Screen
+// are merged into one Square per Screen Cell instead of being drawn one by one
+void edgeMeshDraw(EdgeMesh *mesh, int edges[], int edgeCount, float zoom, Color edgeColor, Color labelColor)
+{
+    bool detailed = zoom >= EDGE_MESH_DETAIL_ZOOM;
+    float cellSize = EDGE_MESH_MIN_PIXELS / zoom;
+    int submitted = 0, cellCount = 0;
+
+    mesh->drawnEdges = 0;
+    mesh->mergedCells = 0;
+    rlCheckRenderBatchLimit(3 * EDGE_MESH_CHUNK_TRIANGLES);
+    rlBegin(RL_TRIANGLES);
+    rlColor4ub(edgeColor.r, edgeColor.g, edgeColor.b, edgeColor.a);
+    for (int k = 0; k < edgeCount; k++)
+    {
+        int first = mesh->edgeTriangle[edges[k]];
+        if (first == -1)
+            continue;
+
+        Vector2 a = mesh->points[edges[k] / MAX_VERTICES], b = mesh->points[edges[k] % MAX_VERTICES];
+        float dx = b.x - a.x, dy = b.y - a.y;
+        if ((dx * dx + dy * dy) * zoom * zoom < EDGE_MESH_MIN_PIXELS * EDGE_MESH_MIN_PIXELS)
+        {
+            int cx = (int)floorf((a.x + b.x) / 2 / cellSize), cy = (int)floorf((a.y + b.y) / 2 / cellSize);
+            mesh->cells[cellCount++] = ((long long)cx << 32) | (unsigned int)cy;
+            continue;
+        }
+
+        int count = detailed ? 3 : 2;
+        _reserveTriangles(&submitted, count, edgeColor);
+        for (int v = 3 * first; v < 3 * (first + count); v++)
+            rlVertex2f(mesh->vertices[v].x, mesh->vertices[v].y);
+        mesh->drawnEdges++;
+    }
+
+    // Merge the short Edges, each occupied Screen Cell drawn once as a Square
+    qsort(mesh->cells, cellCount, sizeof(long long), _compareCells);
+    for (int k = 0; k < cellCount; k++)
+    {
+        if (k > 0 && mesh->cells[k] == mesh->cells[k - 1])
+            continue;
+        float x = (float)(int)(mesh->cells[k] >> 32) * cellSize, y = (float)(int)(unsigned int)mesh->cells[k] * cellSize;
+        _reserveTriangles(&submitted, 2, edgeColor);
+        rlVertex2f(x, y);
+        rlVertex2f(x, y + cellSize);
+        rlVertex2f(x + cellSize, y + cellSize);
+        rlVertex2f(x, y);
+        rlVertex2f(x + cellSize, y + cellSize);
+        rlVertex2f(x + cellSize, y);
+        mesh->mergedCells++;
+    }
+    rlEnd();
+
+    if (!detailed)
+        return;
+    for (int k = 0; k < edgeCount; k++)
+    {
+        int label = mesh->edgeLabel[edges[k]];
+        if (label != -1)
+            DrawText(mesh->labels[label], (int)mesh->labelPositions[label].x, (int)mesh->labelPositions[label].y, 10, labelColor);
+    }
+}
@@ -0,0 +1,42 @@
+#ifndef _EDGE_MESH_H_
+#define _EDGE_MESH_H_
+
+#include <stdbool.h>
+
+#include "raylib.h"
+
+#include "graph.h"
+
+#define EDGE_MESH_MAX_TRIANGLES (MAX_VERTICES * MAX_VERTICES * 3)
+#define EDGE_MESH_CHUNK_TRIANGLES 1024
+#define EDGE_MESH_DETAIL_ZOOM 0.6f
+#define EDGE_MESH_MIN_PIXELS 3.0f
+
+// Cached Triangles for every drawn Edge and its Arrowhead, with the Weight Labels
+// Rebuilt only when the Graph, the Points, the hidden Vertices or the Thickness change
+// Drawn per Edge so only the visible ones are submitted, with less Detail when zoomed out
+typedef struct edgeMesh_t {
+    unsigned int version;                 // Graph Version the Geometry was built for (0 if never built)
+    int pointCount;                       // Point Count the Geometry was built for
+    float thickness;                      // Edge Thickness the Geometry was built for
+    Vector2 points[MAX_VERTICES];         // Point Positions the Geometry was built for
+    bool hidden[MAX_VERTICES];            // Hidden Vertices the Geometry was built for
+    int triangleCount;                    // Number of Triangles
+    Vector2 *vertices;                    // Triangle Corners, three per Triangle
+    int edgeTriangle[MAX_VERTICES * MAX_VERTICES]; // First of the three Triangles of each Edge u * MAX_VERTICES + v (-1 if none)
+    int edgeLabel[MAX_VERTICES * MAX_VERTICES];    // Weight Label of each Edge (-1 if none)
+    int labelCount;                       // Number of Weight Labels
+    Vector2 *labelPositions;              // Position of each Weight Label
+    char (*labels)[12];                   // Text of each Weight Label
+    int rebuilds;                         // Times the Geometry was rebuilt
+    long long *cells;                     // Screen Cells of the Edges too short to draw, merged on every Draw
+    int drawnEdges;                       // Edges drawn by the last Draw
+    int mergedCells;                      // Screen Cells the short Edges of the last Draw were merged into
+} EdgeMesh;
+
+void edgeMeshInit(EdgeMesh *mesh);
+void edgeMeshDeinit(EdgeMesh *mesh);
+bool edgeMeshUpdate(EdgeMesh *mesh, Graph *g, Vector2 *points, int pointCount, bool hidden[], float thickness);
+void edgeMeshDraw(EdgeMesh *mesh, int edges[], int edgeCount, float zoom, Color edgeColor, Color labelColor);
+
+#endif
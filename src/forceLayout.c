@@ -0,0 +1,218 @@
+#include "forceLayout.h"
+
+#include <math.h>
+
+#include "parallel.h"
+
+#define LAYOUT_MIN_EDGE_LENGTH 72.0f
+
+// Add an empty Quadtree Cell, returns its Index
+static int _newNode(ForceLayout *layout, float x, float y, float size)
+{
+    LayoutNode *cell = &layout->nodes[layout->nodeCount];
+    cell->x = x;
+    cell->y = y;
+    cell->size = size;
+    cell->sumX = cell->sumY = 0.0f;
+    cell->mass = 0;
+    cell->vertex = -1;
+    for (int q = 0; q < 4; q++)
+        cell->child[q] = -1;
+    return layout->nodeCount++;
+}
+
+// Quadrant of a Cell a Position falls into
+static inline int _quadrant(LayoutNode *cell, Vector2 p)
+{
+    return (p.x >= cell->x + cell->size / 2) + 2 * (p.y >= cell->y + cell->size / 2);
+}
+
+// Check if a Position lies inside a Cell
+static inline bool _inside(LayoutNode *cell, Vector2 p)
+{
+    return p.x >= cell->x && p.x < cell->x + cell->size && p.y >= cell->y && p.y < cell->y + cell->size;
+}
+
+// Insert a Vertex, splitting Leaves until it has one to itself
+// Below the Maximum Depth a Leaf holds at most one Vertex, at it Leaves just pile Vertices up
+static void _insert(ForceLayout *layout, int v)
+{
+    Vector2 p = layout->positions[v];
+    int node = 0;
+
+    for (int depth = 0; ; depth++)
+    {
+        LayoutNode *cell = &layout->nodes[node];
+        int before = cell->mass;
+        cell->sumX += p.x;
+        cell->sumY += p.y;
+        cell->mass++;
+
+        if (cell->child[0] == -1)
+        {
+            if (before == 0)
+            {
+                cell->vertex = v;
+                return;
+            }
+            if (depth == LAYOUT_MAX_DEPTH)
+            {
+                cell->vertex = -1;
+                return;
+            }
+
+            // Split, pushing the resident Vertex down a Level
+            float half = cell->size / 2;
+            for (int q = 0; q < 4; q++)
+                cell->child[q] = _newNode(layout, cell->x + (q & 1) * half, cell->y + (q >> 1) * half, half);
+            int resident = cell->vertex;
+            LayoutNode *down = &layout->nodes[cell->child[_quadrant(cell, layout->positions[resident])]];
+            down->sumX = layout->positions[resident].x;
+            down->sumY = layout->positions[resident].y;
+            down->mass = 1;
+            down->vertex = resident;
+            cell->vertex = -1;
+        }
+        node = cell->child[_quadrant(cell, p)];
+    }
+}
+
+// Build the Quadtree over the current Positions, the Root a Square around all of them
+static void _buildQuadtree(ForceLayout *layout)
+{
+    float minX = layout->positions[0].x, maxX = minX, minY = layout->positions[0].y, maxY = minY;
+    for (int v = 1; v < layout->n; v++)
+    {
+        minX = fminf(minX, layout->positions[v].x);
+        maxX = fmaxf(maxX, layout->positions[v].x);
+        minY = fminf(minY, layout->positions[v].y);
+        maxY = fmaxf(maxY, layout->positions[v].y);
+    }
+
+    layout->nodeCount = 0;
+    _newNode(layout, minX - 1.0f, minY - 1.0f, fmaxf(maxX - minX, maxY - minY) + 2.0f);
+    for (int v = 0; v < layout->n; v++)
+        _insert(layout, v);
+}
+
+// Repulsion on a Vertex from all others, Cells far enough away acting as one Body at their Centre of Mass
+// Cells containing the Vertex are always opened, so it never repels itself
+static Vector2 _repulsion(ForceLayout *layout, int v)
+{
+    Vector2 p = layout->positions[v], force = {0.0f, 0.0f};
+    int stack[4 * LAYOUT_MAX_DEPTH + 4], top = 0;
+
+    stack[top++] = 0;
+    while (top > 0)
+    {
+        LayoutNode *cell = &layout->nodes[stack[--top]];
+        float mass = (float)cell->mass, sumX = cell->sumX, sumY = cell->sumY;
+        bool leaf = (cell->child[0] == -1), inside = _inside(cell, p);
+
+        if (leaf && inside)
+        {
+            mass -= 1.0f;
+            sumX -= p.x;
+            sumY -= p.y;
+        }
+        if (mass < 0.5f)
+            continue;
+
+        float dx = p.x - sumX / mass, dy = p.y - sumY / mass, distanceSquared = dx * dx + dy * dy;
+        if (!leaf && (inside || cell->size * cell->size > layout->theta * layout->theta * distanceSquared))
+        {
+            for (int q = 0; q < 4; q++)
+                stack[top++] = cell->child[q];
+            continue;
+        }
+
+        // Vertices on top of each other are pushed apart in a Direction fixed by the Vertex
+        if (distanceSquared < 1e-4f)
+        {
+            dx = 0.01f * cosf((float)v);
+            dy = 0.01f * sinf((float)v);
+            distanceSquared = 1e-4f;
+        }
+        float distance = sqrtf(distanceSquared), magnitude = layout->k * layout->k * mass / distance;
+        force.x += dx / distance * magnitude;
+        force.y += dy / distance * magnitude;
+    }
+    return force;
+}
+
+// Net Force on one Vertex: Repulsion, Attraction along its Edges and Gravity towards the Centre
+static void _layoutForce(int v, int threadId, void *context)
+{
+    (void)threadId;
+    ForceLayout *layout = (ForceLayout *)context;
+    Vector2 p = layout->positions[v], force = _repulsion(layout, v);
+
+    for (int k = layout->neighbourStart[v]; k < layout->neighbourStart[v + 1]; k++)
+    {
+        Vector2 q = layout->positions[layout->neighbours[k]];
+        float dx = p.x - q.x, dy = p.y - q.y, distance = sqrtf(dx * dx + dy * dy);
+        force.x -= dx * distance / layout->k;
+        force.y -= dy * distance / layout->k;
+    }
+    force.x -= (p.x - layout->center.x) * LAYOUT_GRAVITY;
+    force.y -= (p.y - layout->center.y) * LAYOUT_GRAVITY;
+    layout->displacement[v] = force;
+}
+
+// Start a Layout from the current Points, spread over about a Circle of the given Radius
+void forceLayoutInit(ForceLayout *layout, Graph *g, Vector2 *points, int count, Vector2 center, float radius)
+{
+    layout->n = (count < g->n) ? count : g->n;
+    layout->center = center;
+    layout->k = (layout->n > 0) ? fmaxf(1.2f * radius / sqrtf((float)layout->n), LAYOUT_MIN_EDGE_LENGTH) : LAYOUT_MIN_EDGE_LENGTH;
+    layout->theta = LAYOUT_THETA;
+    layout->temperature = radius / 4;
+    layout->iterations = 0;
+    layout->converged = (layout->n == 0);
+    layout->pinned = -1;
+    layout->nodeCount = 0;
+
+    int found = 0;
+    for (int u = 0; u < layout->n; u++)
+    {
+        layout->positions[u] = points[u];
+        layout->displacement[u] = (Vector2){0.0f, 0.0f};
+        layout->neighbourStart[u] = found;
+        for (int v = 0; v < layout->n; v++)
+            if (u != v && (g->adj[u][v] >= 1 || g->adj[v][u] >= 1))
+                layout->neighbours[found++] = v;
+    }
+    layout->neighbourStart[layout->n] = found;
+}
+
+// Run one Iteration, returns true once the Layout has converged
+// Forces are computed for all Vertices from the same Positions, split across threadCount Threads, then applied
+// with every Step capped by the Temperature, which cools after each Iteration
+bool forceLayoutStep(ForceLayout *layout, int threadCount)
+{
+    if (layout->converged)
+        return true;
+
+    _buildQuadtree(layout);
+    if (layout->n >= LAYOUT_PARALLEL_MIN_VERTICES && threadCount > 1)
+        parallelFor(layout->n, threadCount, _layoutForce, layout);
+    else
+        for (int v = 0; v < layout->n; v++)
+            _layoutForce(v, 0, layout);
+
+    for (int v = 0; v < layout->n; v++)
+    {
+        Vector2 d = layout->displacement[v];
+        float length = sqrtf(d.x * d.x + d.y * d.y);
+        if (v == layout->pinned || length <= 0.0f)
+            continue;
+        float step = fminf(length, layout->temperature);
+        layout->positions[v].x += d.x / length * step;
+        layout->positions[v].y += d.y / length * step;
+    }
+
+    layout->temperature *= LAYOUT_COOLING;
+    layout->iterations++;
+    layout->converged = layout->temperature < LAYOUT_MIN_TEMPERATURE || layout->iterations >= LAYOUT_MAX_ITERATIONS;
+    return layout->converged;
+}
@@ -0,0 +1,51 @@
+#ifndef _FORCE_LAYOUT_H_
+#define _FORCE_LAYOUT_H_
+
+#include <stdbool.h>
+
+#include "raylib.h"
+
+#include "graph.h"
+
+#define LAYOUT_MAX_DEPTH 16
+#define LAYOUT_MAX_NODES (MAX_VERTICES * LAYOUT_MAX_DEPTH * 4 + 1)
+#define LAYOUT_THETA 0.8f
+#define LAYOUT_COOLING 0.96f
+#define LAYOUT_MIN_TEMPERATURE 0.5f
+#define LAYOUT_GRAVITY 0.05f
+#define LAYOUT_MAX_ITERATIONS 500
+#define LAYOUT_PARALLEL_MIN_VERTICES 32
+
+// Cell of the Barnes-Hut Quadtree, summarising the Vertices inside it by their Count and Centre of Mass
+typedef struct layoutNode_t {
+    float x, y;                           // Top Left Corner
+    float size;                           // Side Length
+    float sumX, sumY;                     // Sum of the Positions inside
+    int mass;                             // Number of Vertices inside
+    int vertex;                           // Only Vertex inside a Leaf (-1 if empty, internal or holding several)
+    int child[4];                         // Quadrants (-1 for a Leaf)
+} LayoutNode;
+
+// Fruchterman-Reingold Layout, Repulsion approximated with a Barnes-Hut Quadtree
+// Edges are copied at Initialization and treated as undirected, so a running Layout never reads the Graph
+typedef struct forceLayout_t {
+    int n;                                // Number of Vertices
+    Vector2 center;                       // Point the Gravity pulls towards
+    float k;                              // Ideal Edge Length
+    float theta;                          // Opening Angle, a Cell closer than size / theta is opened (0 for exact Repulsion)
+    float temperature;                    // Largest Step a Vertex may take in the next Iteration
+    int iterations;                       // Iterations run
+    bool converged;                       // Whether the Temperature has dropped below the Minimum
+    int pinned;                           // Vertex held in Place, e.g. while dragged (-1 if none)
+    Vector2 positions[MAX_VERTICES];      // Position of each Vertex
+    Vector2 displacement[MAX_VERTICES];   // Net Force on each Vertex in the last Iteration
+    int neighbourStart[MAX_VERTICES + 1]; // Start of each Vertex's Neighbours
+    int neighbours[MAX_VERTICES * MAX_VERTICES]; // Neighbours of every Vertex, back to back
+    int nodeCount;                        // Quadtree Cells in use
+    LayoutNode nodes[LAYOUT_MAX_NODES];   // Quadtree Cells, the Root first
+} ForceLayout;
+
+void forceLayoutInit(ForceLayout *layout, Graph *g, Vector2 *points, int count, Vector2 center, float radius);
+bool forceLayoutStep(ForceLayout *layout, int threadCount);
+
+#endif
@@ -0,0 +1,109 @@
+#include "frameProfiler.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "parallel.h"
+#include "trace.h"
+
+// Order Times from shortest to longest
+static int _compareSeconds(const void *a, const void *b)
+{
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+// Initialize a disabled Profiler with no Frames
+void profilerInit(FrameProfiler *profiler)
+{
+    memset(profiler, 0, sizeof(*profiler));
+}
+
+// Start or stop recording, starting afresh when enabled so old Frames do not skew the Percentiles
+void profilerEnable(FrameProfiler *profiler, bool enabled)
+{
+    if (enabled && !profiler->enabled)
+        profilerInit(profiler);
+    profiler->enabled = enabled;
+}
+
+// Mark the Start of a Frame
+// The Frame and its Phases also go to a running Trace Capture, whether or not the Profiler is enabled
+void profilerBeginFrame(FrameProfiler *profiler)
+{
+    traceBegin("Frame");
+    if (!profiler->enabled)
+        return;
+    profiler->frameStart = parallelTime();
+    for (int phase = 0; phase < PROFILE_PHASES; phase++)
+        profiler->current[phase] = 0.0f;
+}
+
+// Mark the End of a Frame and record it
+void profilerEndFrame(FrameProfiler *profiler)
+{
+    traceEnd("Frame");
+    if (!profiler->enabled)
+        return;
+    profilerRecord(profiler, profiler->current, (float)(parallelTime() - profiler->frameStart));
+}
+
+// Start timing a Phase
+void profilerBegin(FrameProfiler *profiler, ProfilePhase phase)
+{
+    traceBegin(profilerPhaseName(phase));
+    if (!profiler->enabled)
+        return;
+    profiler->phaseStart[phase] = parallelTime();
+}
+
+// Stop timing a Phase, adding to the Time it already spent this Frame
+void profilerEnd(FrameProfiler *profiler, ProfilePhase phase)
+{
+    traceEnd(profilerPhaseName(phase));
+    if (!profiler->enabled)
+        return;
+    profiler->current[phase] += (float)(parallelTime() - profiler->phaseStart[phase]);
+}
+
+// Add a Frame to the Ring Buffer, overwriting the oldest once it is full
+void profilerRecord(FrameProfiler *profiler, const float phaseSeconds[PROFILE_PHASES], float frameSeconds)
+{
+    int slot = profiler->frames % PROFILE_FRAMES;
+    memcpy(profiler->phaseSeconds[slot], phaseSeconds, sizeof(profiler->phaseSeconds[slot]));
+    profiler->frameSeconds[slot] = frameSeconds;
+    profiler->frames++;
+}
+
+// Number of Frames held in the Ring Buffer
+int profilerFrameCount(FrameProfiler *profiler)
+{
+    return (profiler->frames < PROFILE_FRAMES) ? profiler->frames : PROFILE_FRAMES;
+}
+
+// Length of a recorded Frame, age 0 being the latest
+float profilerFrame(FrameProfiler *profiler, int age)
+{
+    return profiler->frameSeconds[(profiler->frames - 1 - age + PROFILE_FRAMES) % PROFILE_FRAMES];
+}
+
+// Time below which the given Fraction of recorded Frames fall for a Phase, or for whole Frames with PROFILE_PHASES
+float profilerPercentile(FrameProfiler *profiler, int phase, float fraction)
+{
+    float sorted[PROFILE_FRAMES];
+    int count = profilerFrameCount(profiler);
+    if (count == 0)
+        return 0.0f;
+
+    for (int i = 0; i < count; i++)
+        sorted[i] = (phase == PROFILE_PHASES) ? profiler->frameSeconds[i] : profiler->phaseSeconds[i][phase];
+    qsort(sorted, count, sizeof(float), _compareSeconds);
+    return sorted[(int)(fraction * (count - 1) + 0.5f)];
+}
+
+// Name of a Phase for Display
+const char *profilerPhaseName(ProfilePhase phase)
+{
+    static const char *names[PROFILE_PHASES + 1] = {"Update", "Edges", "Vertices", "Algorithm", "GUI", "EndDrawing", "Frame"};
+    return names[phase];
+}
@@ -0,0 +1,43 @@
+#ifndef _FRAME_PROFILER_H_
+#define _FRAME_PROFILER_H_
+
+#include <stdbool.h>
+
+#define PROFILE_FRAMES 240
+
+// Parts of a Frame timed separately
+typedef enum profilePhase {
+    PROFILE_UPDATE = 0,  // Input, Picking and Thread Logic
+    PROFILE_EDGES,       // Edge Geometry and Submission
+    PROFILE_VERTICES,    // Vertex Circles and Labels
+    PROFILE_ALGORITHM,   // Reading and drawing Algorithm States
+    PROFILE_GUI,         // Buttons, Windows and Labels
+    PROFILE_END_DRAWING, // EndDrawing, including the Wait for the Swap
+    PROFILE_PHASES       // Number of Phases
+} ProfilePhase;
+
+// Scoped Timers for the Phases of a Frame, with the last Frames kept in a Ring Buffer
+// While disabled every Call returns at once, so the Timers can stay in Place
+typedef struct frameProfiler_t {
+    bool enabled;                                     // Whether Frames are being recorded
+    int frames;                                       // Frames recorded since the last Reset
+    double frameStart;                                // Start of the current Frame
+    double phaseStart[PROFILE_PHASES];                // Start of each Phase currently running
+    float current[PROFILE_PHASES];                    // Time spent in each Phase so far this Frame
+    float phaseSeconds[PROFILE_FRAMES][PROFILE_PHASES]; // Time spent in each Phase of the recorded Frames
+    float frameSeconds[PROFILE_FRAMES];               // Length of the recorded Frames
+} FrameProfiler;
+
+void profilerInit(FrameProfiler *profiler);
+void profilerEnable(FrameProfiler *profiler, bool enabled);
+void profilerBeginFrame(FrameProfiler *profiler);
+void profilerEndFrame(FrameProfiler *profiler);
+void profilerBegin(FrameProfiler *profiler, ProfilePhase phase);
+void profilerEnd(FrameProfiler *profiler, ProfilePhase phase);
+void profilerRecord(FrameProfiler *profiler, const float phaseSeconds[PROFILE_PHASES], float frameSeconds);
+int profilerFrameCount(FrameProfiler *profiler);
+float profilerFrame(FrameProfiler *profiler, int age);
+float profilerPercentile(FrameProfiler *profiler, int phase, float fraction);
+const char *profilerPhaseName(ProfilePhase phase);
+
+#endif
@@ -3,6 +3,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Source of Graph Versions, shared so that a re-initialized Graph never repeats an old Version
+static unsigned int graphVersionCounter = 0;
 
 // Initialize a Graph with n vertices
 void graphInit(Graph *g, int n, char *labels[n])
@@ -28,6 +34,8 @@ void graphInit(Graph *g, int n, char *labels[n])
     for (int i = 0; i < MAX_VERTICES; i++)
         for (int j = 0; j < MAX_VERTICES; j++)
             g->adj[i][j] = 0;
+
+    graphTouch(g);
 }
 
 // Deinitialize a Graph
@@ -38,6 +46,21 @@ void graphDeinit(Graph *g)
     g->n = 0;
 }
 
+// Mark the Graph as modified, must be called after writing to adj directly
+void graphTouch(Graph *g)
+{
+    g->version = __atomic_add_fetch(&graphVersionCounter, 1, __ATOMIC_RELAXED);
+}
+
+// Find the Index of a Vertex by its Label, returns -1 if there is none
+int findVertex(Graph *g, char *label)
+{
+    for (int i = 0; i < g->n; i++)
+        if (strcmp(g->labels[i], label) == 0)
+            return i;
+    return -1;
+}
+
 // Add a Vertex to the Graph
 int addVertex(Graph *g, char *label)
 {
@@ -46,6 +69,7 @@ int addVertex(Graph *g, char *label)
 
     g->labels[g->n] = strdup(label);
     g->n++;
+    graphTouch(g);
     return 0;
 }
 
@@ -57,6 +81,7 @@ int editVertex(Graph *g, char *label, char *newLabel)
         {
             free(g->labels[i]);
             g->labels[i] = strdup(newLabel);
+            graphTouch(g);
             return 0;
         }
     return -1;
@@ -87,6 +112,7 @@ int editEdge(Graph *g, char *labelU, char *labelV, int weight)
         return -1;
 
     g->adj[u][v] = weight;
+    graphTouch(g);
 
     return 0;
 }
@@ -107,6 +133,7 @@ int editGraph(Graph *g, int n, char *labels[n], int newAdj[n][n])
         for (int i = 0; i < n; i++)
             for (int j = 0; j < n; j++)
                 g->adj[i][j] = newAdj[i][j];
+    graphTouch(g);
 
     return 0;
 }
@@ -226,3 +253,156 @@ void djk(Graph *g, int u, int dist[], int prev[], priorityQueue *verticesWithDis
     for (int i = 0; i < g->n; i++)
         printf("%s <- %s: %d\n", g->labels[i], (prev[i] >= 0) ? g->labels[prev[i]] : g->labels[i], dist[i]);
 }
+
+// Breadth-First Search recording Hop Distances (-1 if unreachable) and the Visit Order
+// Returns the Number of Vertices reached
+int bfsDistances(Graph *g, int u, int dist[], int order[])
+{
+    int front = 0, rear = 0;
+
+    for (int i = 0; i < g->n; i++)
+        dist[i] = -1;
+
+    dist[u] = 0;
+    order[rear++] = u;
+
+    while (front < rear) {
+        u = order[front++];
+
+        for (int v = 0; v < g->n; v++)
+            if (g->adj[u][v] && dist[v] == -1) {
+                dist[v] = dist[u] + 1;
+                order[rear++] = v;
+            }
+    }
+    return rear;
+}
+
+// Dijkstra's Algorithm recording Distances (INT_MAX if unreachable), Parents and the Order Vertices are settled in
+// Returns the Number of Vertices reached
+int djkDistances(Graph *g, int u, int dist[], int prev[], int order[])
+{
+    priorityQueue verticesWithDistance;
+    bool queued[MAX_VERTICES];
+    int settled = 0;
+
+    pQueueInit(&verticesWithDistance);
+    for (int i = 0; i < g->n; i++)
+    {
+        dist[i] = INT_MAX;
+        prev[i] = -1;
+        queued[i] = false;
+    }
+
+    dist[u] = 0;
+    queued[u] = true;
+    pQueueInsert(&verticesWithDistance, u, 0);
+
+    while (verticesWithDistance.filled > 0)
+    {
+        u = pQueueExtractMin(&verticesWithDistance);
+        order[settled++] = u;
+
+        for (int v = 0; v < g->n; v++)
+            if (g->adj[u][v] && dist[v] > dist[u] + g->adj[u][v])
+            {
+                dist[v] = dist[u] + g->adj[u][v];
+                prev[v] = u;
+                if (queued[v])
+                    pQueueDecreaseKey(&verticesWithDistance, v, dist[v]);
+                else
+                {
+                    queued[v] = true;
+                    pQueueInsert(&verticesWithDistance, v, dist[v]);
+                }
+            }
+    }
+
+    pQueueDeinit(&verticesWithDistance);
+    return settled;
+}
+
+// Breadth-First Search that stops maxHops Hops away from u, so Work follows the Size of the Ball
+// The Ball is returned in Visit Order with each Vertex's Hop Count alongside, returns the Number of Vertices in it
+int bfsBall(Graph *g, int u, int maxHops, int ball[], int dist[])
+{
+    uint64_t seen[(MAX_VERTICES + 63) / 64] = {0};
+    int front = 0, rear = 0;
+
+    seen[u / 64] |= 1ULL << (u % 64);
+    ball[rear] = u;
+    dist[rear++] = 0;
+
+    while (front < rear && dist[front] < maxHops) {
+        int w = ball[front], hops = dist[front++] + 1;
+
+        for (int v = 0; v < g->n; v++)
+            if (g->adj[w][v] && !(seen[v / 64] & (1ULL << (v % 64)))) {
+                seen[v / 64] |= 1ULL << (v % 64);
+                ball[rear] = v;
+                dist[rear++] = hops;
+            }
+    }
+    return rear;
+}
+
+// Dijkstra's Algorithm that stops once the next Vertex lies beyond radius, so Work follows the Size of the Ball
+// The Ball is returned in Settle Order with each Vertex's Distance alongside, returns the Number of Vertices in it
+int djkBall(Graph *g, int u, int radius, int ball[], int dist[])
+{
+    uint64_t seen[(MAX_VERTICES + 63) / 64] = {0};
+    int tentative[MAX_VERTICES], settled = 0;
+    priorityQueue verticesWithDistance;
+
+    pQueueInit(&verticesWithDistance);
+    seen[u / 64] |= 1ULL << (u % 64);
+    tentative[u] = 0;
+    pQueueInsert(&verticesWithDistance, u, 0);
+
+    while (verticesWithDistance.filled > 0 && verticesWithDistance.heap[0].priority <= radius)
+    {
+        u = pQueueExtractMin(&verticesWithDistance);
+        ball[settled] = u;
+        dist[settled++] = tentative[u];
+
+        for (int v = 0; v < g->n; v++)
+        {
+            if (!g->adj[u][v] || tentative[u] + g->adj[u][v] > radius)
+                continue;
+            if (!(seen[v / 64] & (1ULL << (v % 64))))
+            {
+                seen[v / 64] |= 1ULL << (v % 64);
+                tentative[v] = tentative[u] + g->adj[u][v];
+                pQueueInsert(&verticesWithDistance, v, tentative[v]);
+            }
+            else if (tentative[u] + g->adj[u][v] < tentative[v])
+            {
+                tentative[v] = tentative[u] + g->adj[u][v];
+                pQueueDecreaseKey(&verticesWithDistance, v, tentative[v]);
+            }
+        }
+    }
+
+    pQueueDeinit(&verticesWithDistance);
+    return settled;
+}
+
+// Copy the Subgraph induced by count Vertices of g into sub, Vertex i of sub being vertices[i]
+// sub must not be initialized, returns 0 on Success and -1 if there are too many Vertices
+int inducedSubgraph(Graph *g, int vertices[], int count, Graph *sub)
+{
+    if (count > MAX_VERTICES)
+        return -1;
+
+    char *labels[MAX_VERTICES];
+    for (int i = 0; i < count; i++)
+        labels[i] = g->labels[vertices[i]];
+    graphInit(sub, count, labels);
+
+    for (int i = 0; i < count; i++)
+        for (int j = 0; j < count; j++)
+            sub->adj[i][j] = g->adj[vertices[i]][vertices[j]];
+    graphTouch(sub);
+
+    return 0;
+}
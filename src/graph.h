@@ -9,10 +9,13 @@ typedef struct graph_t {
     int n;                               // Number of Vertices
     char *labels[MAX_VERTICES];          // Vertex Labels
     int adj[MAX_VERTICES][MAX_VERTICES]; // Adjacency Matrix
+    unsigned int version;                // Changes whenever the Graph is modified
 } Graph;
 
 void graphInit(Graph *g, int n, char *labels[n]);
 void graphDeinit(Graph *g);
+void graphTouch(Graph *g);
+int findVertex(Graph *g, char *label);
 int addVertex(Graph *g, char *label);
 int editVertex(Graph *g, char *label, char *newLabel);
 int addEdge(Graph *g, char *labelU, char *labelV);
@@ -26,5 +29,10 @@ void depthFirstSearch(Graph *g, char *label);
 void dfs(Graph *g, int u, int visited[]);
 void dijkstra(Graph *g, char *label);
 void djk(Graph *g, int u, int dist[], int prev[], priorityQueue *verticesWithDistance, int visited[]);
+int bfsDistances(Graph *g, int u, int dist[], int order[]);
+int djkDistances(Graph *g, int u, int dist[], int prev[], int order[]);
+int bfsBall(Graph *g, int u, int maxHops, int ball[], int dist[]);
+int djkBall(Graph *g, int u, int radius, int ball[], int dist[]);
+int inducedSubgraph(Graph *g, int vertices[], int count, Graph *sub);
 
 #endif
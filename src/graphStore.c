@@ -0,0 +1,95 @@
+#include "graphStore.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Copy the Graph into a Version, keeping its Version Number so Caches keyed on it still match
+// Only the Rows of Vertices in use are copied, and Labels the Version already holds are kept rather than duplicated
+static void _copy(GraphVersion *version, Graph *g)
+{
+    Graph *copy = &version->graph;
+    for (int i = 0; i < copy->n || i < g->n; i++)
+    {
+        bool held = (i < copy->n);
+        if (i >= g->n || (held && strcmp(copy->labels[i], g->labels[i]) != 0))
+        {
+            free(copy->labels[i]);
+            held = false;
+        }
+        if (i < g->n && !held)
+            copy->labels[i] = strdup(g->labels[i]);
+    }
+    memcpy(copy->adj, g->adj, g->n * sizeof(g->adj[0]));
+    copy->n = g->n;
+    copy->version = g->version;
+}
+
+// Initialize a Store with the Graph as its first Version
+void graphStoreInit(GraphStore *store, Graph *g)
+{
+    store->versions = (GraphVersion *)calloc(GRAPH_STORE_VERSIONS, sizeof(GraphVersion));
+    for (int i = 0; i < GRAPH_STORE_VERSIONS; i++)
+        atomic_init(&store->versions[i].pins, 0);
+    _copy(&store->versions[0], g);
+    atomic_init(&store->current, &store->versions[0]);
+    store->publishes = 1;
+}
+
+// Free every Version, only once no Reader holds any of them
+void graphStoreDeinit(GraphStore *store)
+{
+    for (int i = 0; i < GRAPH_STORE_VERSIONS; i++)
+        graphDeinit(&store->versions[i].graph);
+    free(store->versions);
+    store->versions = NULL;
+}
+
+// Publish the Graph as the latest Version if it changed since the last one, only from the Writer Thread
+// The Version replaced stays readable for the Readers pinning it, and is reclaimed once they have all let go
+// Returns 0 on Success and -1 if every other Version is still pinned, in which case the Caller tries again later
+int graphStorePublish(GraphStore *store, Graph *g)
+{
+    GraphVersion *current = atomic_load_explicit(&store->current, memory_order_relaxed);
+    if (current->graph.version == g->version)
+        return 0;
+
+    for (int i = 0; i < GRAPH_STORE_VERSIONS; i++)
+    {
+        // Claim a Version nobody holds, locking out Readers that still try to pin it
+        GraphVersion *version = &store->versions[(store->publishes + i) % GRAPH_STORE_VERSIONS];
+        int unpinned = 0;
+        if (version == current || !atomic_compare_exchange_strong_explicit(&version->pins, &unpinned,
+                GRAPH_STORE_RECLAIMING, memory_order_acquire, memory_order_relaxed))
+            continue;
+
+        // Readers turned away meanwhile may not have undone their Pin yet, so only take the Lock-Out back off
+        _copy(version, g);
+        atomic_fetch_sub_explicit(&version->pins, GRAPH_STORE_RECLAIMING, memory_order_release);
+        atomic_store_explicit(&store->current, version, memory_order_release);
+        store->publishes++;
+        return 0;
+    }
+    return -1;
+}
+
+// Pin the latest Version, which stays unchanged until it is unpinned
+GraphVersion *graphStorePin(GraphStore *store)
+{
+    for (;;)
+    {
+        GraphVersion *version = atomic_load_explicit(&store->current, memory_order_acquire);
+
+        // The Version may have been replaced and claimed for Reuse before the Pin landed, so check it is still current
+        if (atomic_fetch_add_explicit(&version->pins, 1, memory_order_acq_rel) >= 0 &&
+            atomic_load_explicit(&store->current, memory_order_acquire) == version)
+            return version;
+        atomic_fetch_sub_explicit(&version->pins, 1, memory_order_release);
+    }
+}
+
+// Let go of a pinned Version
+void graphStoreUnpin(GraphVersion *version)
+{
+    atomic_fetch_sub_explicit(&version->pins, 1, memory_order_release);
+}
@@ -0,0 +1,32 @@
+#ifndef _GRAPH_STORE_H_
+#define _GRAPH_STORE_H_
+
+#include <stdatomic.h>
+
+#include "graph.h"
+
+#define GRAPH_STORE_VERSIONS 8
+#define GRAPH_STORE_RECLAIMING (-(1 << 24))
+
+// Immutable Copy of a Graph, shared by every Reader that pinned it
+typedef struct graphVersion_t {
+    Graph graph;                          // The Copy, never written while published or pinned (Rows past n are stale)
+    atomic_int pins;                      // Readers holding it (GRAPH_STORE_RECLAIMING while being rewritten)
+} GraphVersion;
+
+// Published Versions of a Graph edited by one Writer Thread and read by any Number of Reader Threads
+// Readers pin the latest Version and keep reading it however the Graph changes meanwhile, the Writer copies each
+// Change into a Version no Reader holds, so Edits never wait for a Reader and Readers never take a Lock
+typedef struct graphStore_t {
+    GraphVersion *versions;               // Pool of Versions, each reused once no Reader holds it
+    _Atomic(GraphVersion *) current;      // Latest published Version
+    int publishes;                        // Versions published so far
+} GraphStore;
+
+void graphStoreInit(GraphStore *store, Graph *g);
+void graphStoreDeinit(GraphStore *store);
+int graphStorePublish(GraphStore *store, Graph *g);
+GraphVersion *graphStorePin(GraphStore *store);
+void graphStoreUnpin(GraphVersion *version);
+
+#endif
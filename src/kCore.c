@@ -0,0 +1,166 @@
+#include "kCore.h"
+
+#include <stdbool.h>
+
+#include "parallel.h"
+
+// Undirected Degree of every Vertex, ignoring Self Loops
+static void _undirectedDegrees(Graph *g, int degree[])
+{
+    for (int u = 0; u < g->n; u++)
+    {
+        degree[u] = 0;
+        for (int v = 0; v < g->n; v++)
+            if (u != v && (g->adj[u][v] || g->adj[v][u]))
+                degree[u]++;
+    }
+}
+
+// Finish a Result once all Core Numbers are set
+static void _coreFinish(Graph *g, CoreResult *result)
+{
+    result->n = g->n;
+    result->maxCore = 0;
+    for (int v = 0; v < g->n; v++)
+        if (result->core[v] > result->maxCore)
+            result->maxCore = result->core[v];
+    result->version = g->version;
+}
+
+// Initialize an empty Core Result
+void coreResultInit(CoreResult *result)
+{
+    result->version = 0;
+    result->n = 0;
+    result->maxCore = 0;
+}
+
+// Core Decomposition by Peeling Vertices from Degree Buckets (Batagelj-Zaversnik), returns the highest Core
+int coreDecomposition(Graph *g, CoreResult *result)
+{
+    int n = g->n;
+    int *degree = result->core;
+    int bin[MAX_VERTICES + 1] = {0}, pos[MAX_VERTICES], vert[MAX_VERTICES];
+
+    _undirectedDegrees(g, degree);
+
+    // Bucket Sort Vertices by Degree
+    for (int v = 0; v < n; v++)
+        bin[degree[v]]++;
+    for (int d = 0, start = 0; d < n; d++)
+    {
+        int count = bin[d];
+        bin[d] = start;
+        start += count;
+    }
+    for (int v = 0; v < n; v++)
+    {
+        pos[v] = bin[degree[v]]++;
+        vert[pos[v]] = v;
+    }
+    for (int d = n - 1; d > 0; d--)
+        bin[d] = bin[d - 1];
+    bin[0] = 0;
+
+    // Peel the lowest Degree Vertex, moving each higher Degree Neighbour one Bucket down
+    for (int i = 0; i < n; i++)
+    {
+        int u = vert[i];
+        for (int w = 0; w < n; w++)
+        {
+            if (w == u || !(g->adj[u][w] || g->adj[w][u]) || degree[w] <= degree[u])
+                continue;
+
+            int dw = degree[w], pw = pos[w];
+            int first = bin[dw], firstVertex = vert[first];
+            if (firstVertex != w)
+            {
+                pos[w] = first;
+                vert[first] = w;
+                pos[firstVertex] = pw;
+                vert[pw] = firstVertex;
+            }
+            bin[dw]++;
+            degree[w]--;
+        }
+    }
+
+    _coreFinish(g, result);
+    return result->maxCore;
+}
+
+//----------------------------------------------------------------------------------
+// Parallel Level-Synchronous Peeling
+
+typedef struct coreShared_t {
+    Graph *g;                  // Graph
+    int degree[MAX_VERTICES];  // Remaining Degree of each Vertex
+    bool removed[MAX_VERTICES];// Whether a Vertex was peeled
+    int frontier[MAX_VERTICES];// Vertices peeled in this Step
+    int next[MAX_VERTICES];    // Vertices whose Degree fell to the current Level
+    int nextCount;             // Size of next
+    int level;                 // Current Core Level
+} coreShared;
+
+// Peel one Frontier Vertex, lowering the Degrees of its remaining Neighbours
+static void _corePeel(int index, int threadId, void *context)
+{
+    (void)threadId;
+    coreShared *shared = (coreShared *)context;
+    Graph *g = shared->g;
+    int u = shared->frontier[index];
+
+    for (int w = 0; w < g->n; w++)
+    {
+        if (w == u || shared->removed[w] || !(g->adj[u][w] || g->adj[w][u]))
+            continue;
+
+        // Exactly one Thread sees the Degree cross into the Level and queues the Vertex
+        if (__atomic_sub_fetch(&shared->degree[w], 1, __ATOMIC_RELAXED) == shared->level)
+            shared->next[__atomic_fetch_add(&shared->nextCount, 1, __ATOMIC_RELAXED)] = w;
+    }
+}
+
+// Core Decomposition peeling every Vertex at the current Level at once across threadCount Threads
+// Returns the highest Core
+int parallelCoreDecomposition(Graph *g, int threadCount, CoreResult *result)
+{
+    int n = g->n;
+    coreShared shared;
+    shared.g = g;
+    _undirectedDegrees(g, shared.degree);
+    for (int v = 0; v < n; v++)
+        shared.removed[v] = false;
+
+    int remaining = n;
+    shared.level = 0;
+    while (remaining > 0) {
+        // Start the Level with every remaining Vertex already at or below it
+        int frontierCount = 0;
+        for (int v = 0; v < n; v++)
+            if (!shared.removed[v] && shared.degree[v] <= shared.level)
+                shared.frontier[frontierCount++] = v;
+
+        while (frontierCount > 0) {
+            for (int i = 0; i < frontierCount; i++)
+            {
+                shared.removed[shared.frontier[i]] = true;
+                result->core[shared.frontier[i]] = shared.level;
+            }
+            remaining -= frontierCount;
+
+            shared.nextCount = 0;
+            parallelFor(frontierCount, threadCount, _corePeel, &shared);
+
+            frontierCount = shared.nextCount;
+            for (int i = 0; i < frontierCount; i++)
+                shared.frontier[i] = shared.next[i];
+        }
+
+        shared.level++;
+    }
+
+    _coreFinish(g, result);
+    return result->maxCore;
+}
+//----------------------------------------------------------------------------------
@@ -0,0 +1,20 @@
+#ifndef _K_CORE_H_
+#define _K_CORE_H_
+
+#include "graph.h"
+
+#define KCORE_PARALLEL_MIN_VERTICES 32
+
+// Core Number of every Vertex, Edges taken as undirected
+typedef struct coreResult_t {
+    unsigned int version;    // Graph Version the Cores were computed for (0 if never computed)
+    int n;                   // Number of Vertices
+    int core[MAX_VERTICES];  // Core Number of each Vertex
+    int maxCore;             // Highest Core Number
+} CoreResult;
+
+void coreResultInit(CoreResult *result);
+int coreDecomposition(Graph *g, CoreResult *result);
+int parallelCoreDecomposition(Graph *g, int threadCount, CoreResult *result);
+
+#endif
@@ -0,0 +1,243 @@
+#include "kShortestPaths.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#include "parallel.h"
+
+#define MAX_CANDIDATES (MAX_K_PATHS * MAX_VERTICES)
+
+// A Path waiting to be accepted
+typedef struct candidatePath_t {
+    int length;                 // Path Length
+    int hops;                   // Number of Vertices
+    int vertices[MAX_VERTICES]; // Vertices from Source to Destination
+} candidatePath;
+
+typedef struct yenShared_t {
+    Graph *g;                             // Graph
+    int dest;                             // Destination Vertex
+    int toDest[MAX_VERTICES];             // Distance from each Vertex to the Destination (INT_MAX if none)
+    int nextHop[MAX_VERTICES];            // Successor towards the Destination in the reverse Shortest-Path Tree
+    PathSet *paths;                       // Accepted Paths
+    candidatePath spur[MAX_VERTICES];     // Spur Path found for each Spur Index this Iteration
+    bool found[MAX_VERTICES];             // Whether a Spur Path was found for each Spur Index
+    int searches;                         // Spur Searches run
+} yenShared;
+
+// Distances to the Destination from every Vertex, found by Dijkstra's Algorithm over reversed Edges
+static void _reverseTree(Graph *g, int dest, int toDest[], int nextHop[])
+{
+    bool done[MAX_VERTICES];
+    for (int i = 0; i < g->n; i++)
+    {
+        toDest[i] = INT_MAX;
+        nextHop[i] = -1;
+        done[i] = false;
+    }
+    toDest[dest] = 0;
+
+    while (1) {
+        int v = -1;
+        for (int i = 0; i < g->n; i++)
+            if (!done[i] && toDest[i] != INT_MAX && (v == -1 || toDest[i] < toDest[v]))
+                v = i;
+        if (v == -1)
+            break;
+        done[v] = true;
+
+        for (int u = 0; u < g->n; u++)
+            if (g->adj[u][v] > 0 && !done[u] && toDest[v] + g->adj[u][v] < toDest[u])
+            {
+                toDest[u] = toDest[v] + g->adj[u][v];
+                nextHop[u] = v;
+            }
+    }
+}
+
+// Find the Spur Path deviating from the previous Path at a given Index
+// The Distances to the Destination bound every Spur Search from below, so the Tree Path is reused when it is
+// still allowed and A* guided by those Distances is run only otherwise
+static void _yenSpur(int spurIndex, int threadId, void *context)
+{
+    (void)threadId;
+    yenShared *shared = (yenShared *)context;
+    Graph *g = shared->g;
+    PathSet *paths = shared->paths;
+    int last = paths->count - 1;
+    int *root = paths->vertices[last];
+    int spurNode = root[spurIndex];
+
+    shared->found[spurIndex] = false;
+    if (shared->toDest[spurNode] == INT_MAX)
+        return;
+
+    // Root Path Vertices other than the Spur Node may not be revisited
+    bool blocked[MAX_VERTICES] = {false};
+    int rootLength = 0;
+    for (int i = 0; i < spurIndex; i++)
+    {
+        blocked[root[i]] = true;
+        rootLength += g->adj[root[i]][root[i + 1]];
+    }
+
+    // Edges leaving the Spur Node along any accepted Path sharing this Root are removed
+    bool removed[MAX_VERTICES] = {false};
+    for (int p = 0; p <= last; p++)
+        if (paths->hops[p] > spurIndex + 1 && memcmp(paths->vertices[p], root, (spurIndex + 1) * sizeof(int)) == 0)
+            removed[paths->vertices[p][spurIndex + 1]] = true;
+
+    candidatePath *spur = &shared->spur[spurIndex];
+    for (int i = 0; i <= spurIndex; i++)
+        spur->vertices[i] = root[i];
+    spur->hops = spurIndex + 1;
+
+    // Reuse the Tree Path when it avoids the Root and the removed Edges
+    bool treeUsable = !removed[shared->nextHop[spurNode]];
+    for (int v = shared->nextHop[spurNode]; treeUsable && v != -1; v = shared->nextHop[v])
+        if (blocked[v])
+            treeUsable = false;
+    if (treeUsable)
+    {
+        for (int v = shared->nextHop[spurNode]; v != -1; v = shared->nextHop[v])
+            spur->vertices[spur->hops++] = v;
+        spur->length = rootLength + shared->toDest[spurNode];
+        shared->found[spurIndex] = true;
+        return;
+    }
+
+    __atomic_fetch_add(&shared->searches, 1, __ATOMIC_RELAXED);
+
+    // A* from the Spur Node over the remaining Graph
+    int dist[MAX_VERTICES], prev[MAX_VERTICES];
+    bool done[MAX_VERTICES];
+    for (int i = 0; i < g->n; i++)
+    {
+        dist[i] = INT_MAX;
+        prev[i] = -1;
+        done[i] = blocked[i];
+    }
+    dist[spurNode] = 0;
+
+    while (1) {
+        int u = -1;
+        for (int i = 0; i < g->n; i++)
+            if (!done[i] && dist[i] != INT_MAX && shared->toDest[i] != INT_MAX &&
+                (u == -1 || dist[i] + shared->toDest[i] < dist[u] + shared->toDest[u]))
+                u = i;
+        if (u == -1)
+            return;
+        if (u == shared->dest)
+            break;
+        done[u] = true;
+
+        for (int v = 0; v < g->n; v++)
+            if (g->adj[u][v] > 0 && !done[v] && !(u == spurNode && removed[v]) && dist[u] + g->adj[u][v] < dist[v])
+            {
+                dist[v] = dist[u] + g->adj[u][v];
+                prev[v] = u;
+            }
+    }
+
+    int reversed[MAX_VERTICES], count = 0;
+    for (int v = shared->dest; v != spurNode; v = prev[v])
+        reversed[count++] = v;
+    while (count > 0)
+        spur->vertices[spur->hops++] = reversed[--count];
+    spur->length = rootLength + dist[shared->dest];
+    shared->found[spurIndex] = true;
+}
+
+// Check if two Paths visit the same Vertices
+static bool _samePath(int hopsA, int verticesA[], int hopsB, int verticesB[])
+{
+    return hopsA == hopsB && memcmp(verticesA, verticesB, hopsA * sizeof(int)) == 0;
+}
+
+// Initialize an empty Path Set
+void pathSetInit(PathSet *paths)
+{
+    paths->version = 0;
+    paths->src = -1;
+    paths->dest = -1;
+    paths->count = 0;
+    paths->searches = 0;
+}
+
+// Up to k shortest loopless Paths from src to dest using Yen's Algorithm, returns the Number of Paths found
+// Spur Paths of each Iteration are found in parallel across threadCount Threads
+int kShortestPaths(Graph *g, int src, int dest, int k, int threadCount, PathSet *paths)
+{
+    if (k > MAX_K_PATHS)
+        k = MAX_K_PATHS;
+
+    yenShared *shared = (yenShared *)malloc(sizeof(yenShared));
+    candidatePath *candidates = (candidatePath *)malloc(MAX_CANDIDATES * sizeof(candidatePath));
+    int candidateCount = 0;
+
+    shared->g = g;
+    shared->dest = dest;
+    shared->paths = paths;
+    shared->searches = 0;
+    paths->src = src;
+    paths->dest = dest;
+    paths->count = 0;
+
+    _reverseTree(g, dest, shared->toDest, shared->nextHop);
+
+    // The first Path comes straight from the Shortest-Path Tree
+    if (k > 0 && shared->toDest[src] != INT_MAX)
+    {
+        paths->hops[0] = 0;
+        for (int v = src; v != -1; v = shared->nextHop[v])
+            paths->vertices[0][paths->hops[0]++] = v;
+        paths->length[0] = shared->toDest[src];
+        paths->count = 1;
+    }
+
+    while (paths->count > 0 && paths->count < k) {
+        int last = paths->count - 1;
+        parallelFor(paths->hops[last] - 1, threadCount, _yenSpur, shared);
+
+        // Queue new Candidates that are not already accepted or queued
+        for (int i = 0; i < paths->hops[last] - 1; i++)
+        {
+            candidatePath *spur = &shared->spur[i];
+            if (!shared->found[i])
+                continue;
+
+            bool known = false;
+            for (int c = 0; c < candidateCount && !known; c++)
+                known = _samePath(candidates[c].hops, candidates[c].vertices, spur->hops, spur->vertices);
+            for (int p = 0; p < paths->count && !known; p++)
+                known = _samePath(paths->hops[p], paths->vertices[p], spur->hops, spur->vertices);
+
+            if (!known && candidateCount < MAX_CANDIDATES)
+                candidates[candidateCount++] = *spur;
+        }
+
+        if (candidateCount == 0)
+            break;
+
+        // Accept the shortest Candidate, ties go to the fewest Hops
+        int best = 0;
+        for (int c = 1; c < candidateCount; c++)
+            if (candidates[c].length < candidates[best].length ||
+                (candidates[c].length == candidates[best].length && candidates[c].hops < candidates[best].hops))
+                best = c;
+
+        paths->length[paths->count] = candidates[best].length;
+        paths->hops[paths->count] = candidates[best].hops;
+        memcpy(paths->vertices[paths->count], candidates[best].vertices, candidates[best].hops * sizeof(int));
+        paths->count++;
+        candidates[best] = candidates[--candidateCount];
+    }
+
+    paths->searches = shared->searches;
+    paths->version = g->version;
+    free(candidates);
+    free(shared);
+    return paths->count;
+}
@@ -0,0 +1,23 @@
+#ifndef _K_SHORTEST_PATHS_H_
+#define _K_SHORTEST_PATHS_H_
+
+#include "graph.h"
+
+#define MAX_K_PATHS 8
+
+// Loopless Paths from a Source to a Destination in order of Length
+typedef struct pathSet_t {
+    unsigned int version;                     // Graph Version the Paths were found for (0 if never computed)
+    int src;                                  // Source Vertex
+    int dest;                                 // Destination Vertex
+    int count;                                // Number of Paths found
+    int length[MAX_K_PATHS];                  // Length of each Path
+    int hops[MAX_K_PATHS];                    // Number of Vertices in each Path
+    int vertices[MAX_K_PATHS][MAX_VERTICES];  // Vertices of each Path from Source to Destination
+    int searches;                             // Spur Searches run, the rest were answered from the Shortest-Path Tree
+} PathSet;
+
+void pathSetInit(PathSet *paths);
+int kShortestPaths(Graph *g, int src, int dest, int k, int threadCount, PathSet *paths);
+
+#endif
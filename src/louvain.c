@@ -0,0 +1,272 @@
+#include "louvain.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "parallel.h"
+
+// Weighted undirected Graph of Communities at one Level of the Hierarchy
+typedef struct louvainLevel_t {
+    int n;                                 // Number of Nodes
+    double weight[MAX_VERTICES][MAX_VERTICES]; // Edge Weights, weight[i][i] holds the Weight inside Node i
+    double degree[MAX_VERTICES];           // Weighted Degree of each Node
+    double total;                          // Sum of all Weights (2m)
+} louvainLevel;
+
+// Sparse Map from Community to Weight, a dense Array plus the List of touched Keys
+typedef struct communityWeights_t {
+    double weight[MAX_VERTICES]; // Weight to each Community, 0 if untouched
+    int keys[MAX_VERTICES];      // Touched Communities
+    int count;                   // Number of touched Communities
+} communityWeights;
+
+typedef struct louvainShared_t {
+    louvainLevel *level;                      // Current Level
+    int community[MAX_VERTICES];              // Community of each Node
+    double communityTotal[MAX_VERTICES];      // Sum of Degrees in each Community
+    int communitySize[MAX_VERTICES];          // Nodes in each Community
+    int target[MAX_VERTICES];                 // Best Community found for each Node this Sweep
+    communityWeights maps[MAX_THREADS];       // Per-Thread Community Weight Maps
+} louvainShared;
+
+// Degrees and Total Weight of a Level
+static void _levelDegrees(louvainLevel *level)
+{
+    level->total = 0.0;
+    for (int i = 0; i < level->n; i++)
+    {
+        level->degree[i] = 0.0;
+        for (int j = 0; j < level->n; j++)
+            level->degree[i] += level->weight[i][j];
+        level->total += level->degree[i];
+    }
+}
+
+// Modularity of a Partition of a Level
+static double _levelModularity(louvainLevel *level, int community[])
+{
+    if (level->total <= 0.0)
+        return 0.0;
+
+    double inside[MAX_VERTICES] = {0}, total[MAX_VERTICES] = {0};
+    for (int i = 0; i < level->n; i++)
+    {
+        total[community[i]] += level->degree[i];
+        for (int j = 0; j < level->n; j++)
+            if (community[i] == community[j])
+                inside[community[i]] += level->weight[i][j];
+    }
+
+    double q = 0.0;
+    for (int c = 0; c < level->n; c++)
+        q += inside[c] / level->total - (total[c] / level->total) * (total[c] / level->total);
+    return q;
+}
+
+// Build the first Level from the Graph, summing both Directions of every Edge
+static void _levelFromGraph(Graph *g, louvainLevel *level)
+{
+    level->n = g->n;
+    for (int i = 0; i < g->n; i++)
+        for (int j = 0; j < g->n; j++)
+            level->weight[i][j] = (i == j) ? 0.0 : (double)((g->adj[i][j] > 0) ? g->adj[i][j] : 0) + ((g->adj[j][i] > 0) ? g->adj[j][i] : 0);
+    _levelDegrees(level);
+}
+
+// Find the Community a Node gains the most Modularity by joining, using this Thread's Weight Map
+static void _louvainBestMove(int i, int threadId, void *context)
+{
+    louvainShared *shared = (louvainShared *)context;
+    louvainLevel *level = shared->level;
+    communityWeights *map = &shared->maps[threadId];
+    int own = shared->community[i];
+
+    map->count = 0;
+    map->weight[own] = 0.0;
+    map->keys[map->count++] = own;
+    for (int j = 0; j < level->n; j++)
+    {
+        if (j == i || level->weight[i][j] == 0.0)
+            continue;
+
+        int c = shared->community[j];
+        if (map->weight[c] == 0.0 && c != own)
+            map->keys[map->count++] = c;
+        map->weight[c] += level->weight[i][j];
+    }
+
+    // Gain of joining c once i is taken out of its own Community
+    double k = level->degree[i], m2 = level->total;
+    int best = own;
+    double bestGain = map->weight[own] - (shared->communityTotal[own] - k) * k / m2;
+    for (int key = 0; key < map->count; key++)
+    {
+        int c = map->keys[key];
+        if (c == own)
+            continue;
+
+        double gain = map->weight[c] - shared->communityTotal[c] * k / m2;
+        if (gain > bestGain || (gain == bestGain && c < best))
+        {
+            best = c;
+            bestGain = gain;
+        }
+    }
+
+    // Two Singletons may only merge towards the lower ID, otherwise they could swap forever
+    if (shared->communitySize[own] == 1 && best != own && shared->communitySize[best] == 1 && best > own)
+        best = own;
+    shared->target[i] = best;
+
+    for (int key = 0; key < map->count; key++)
+        map->weight[map->keys[key]] = 0.0;
+}
+
+// Move Nodes between Communities until Modularity stops improving, returns whether any Node moved
+static bool _louvainLocalMoving(louvainShared *shared, int threadCount)
+{
+    louvainLevel *level = shared->level;
+    int n = level->n;
+    bool movedAny = false;
+
+    for (int c = 0; c < n; c++)
+    {
+        shared->community[c] = c;
+        shared->communityTotal[c] = level->degree[c];
+        shared->communitySize[c] = 1;
+    }
+    double q = _levelModularity(level, shared->community);
+
+    for (int sweep = 0; sweep < LOUVAIN_MAX_SWEEPS; sweep++)
+    {
+        int previous[MAX_VERTICES];
+        for (int i = 0; i < n; i++)
+            previous[i] = shared->community[i];
+
+        // Choose Moves in parallel against the same Snapshot, then apply them together
+        parallelFor(n, threadCount, _louvainBestMove, shared);
+
+        int moves = 0;
+        for (int i = 0; i < n; i++)
+        {
+            int from = shared->community[i], to = shared->target[i];
+            if (from == to)
+                continue;
+
+            shared->communityTotal[from] -= level->degree[i];
+            shared->communityTotal[to] += level->degree[i];
+            shared->communitySize[from]--;
+            shared->communitySize[to]++;
+            shared->community[i] = to;
+            moves++;
+        }
+
+        // Concurrent Moves can undo each other, keep the Sweep only if it helped
+        double newQ = _levelModularity(level, shared->community);
+        if (moves == 0 || newQ <= q + LOUVAIN_TOLERANCE)
+        {
+            if (moves > 0 && newQ < q)
+            {
+                for (int c = 0; c < n; c++)
+                {
+                    shared->communityTotal[c] = 0.0;
+                    shared->communitySize[c] = 0;
+                }
+                for (int i = 0; i < n; i++)
+                {
+                    shared->community[i] = previous[i];
+                    shared->communityTotal[previous[i]] += level->degree[i];
+                    shared->communitySize[previous[i]]++;
+                }
+            }
+            else if (moves > 0)
+                movedAny = true;
+            break;
+        }
+
+        q = newQ;
+        movedAny = true;
+    }
+
+    return movedAny;
+}
+
+// Initialize an empty Community Result
+void communityResultInit(CommunityResult *result)
+{
+    result->version = 0;
+    result->n = 0;
+    result->count = 0;
+    result->modularity = 0.0;
+    result->levels = 0;
+}
+
+// Louvain Community Detection with the Local Moving Phase spread across threadCount Threads
+// Each Level moves Nodes, then merges every Community into one Node of a coarser Graph
+// Returns the Number of Communities
+int louvainCommunities(Graph *g, int threadCount, CommunityResult *result)
+{
+    louvainShared *shared = (louvainShared *)calloc(1, sizeof(louvainShared));
+    louvainLevel *level = (louvainLevel *)malloc(sizeof(louvainLevel));
+    louvainLevel *coarse = (louvainLevel *)malloc(sizeof(louvainLevel));
+    shared->level = level;
+
+    _levelFromGraph(g, level);
+    for (int v = 0; v < g->n; v++)
+        result->community[v] = v;
+    result->levels = 0;
+
+    while (level->n > 0 && level->total > 0.0 && _louvainLocalMoving(shared, threadCount)) {
+        result->levels++;
+
+        // Renumber Communities from 0
+        int id[MAX_VERTICES], count = 0;
+        for (int c = 0; c < level->n; c++)
+            id[c] = -1;
+        for (int i = 0; i < level->n; i++)
+            if (id[shared->community[i]] == -1)
+                id[shared->community[i]] = count++;
+        for (int v = 0; v < g->n; v++)
+            result->community[v] = id[shared->community[result->community[v]]];
+        if (count == level->n)
+            break;
+
+        // Aggregate every Community into a single Node
+        coarse->n = count;
+        for (int a = 0; a < count; a++)
+            for (int b = 0; b < count; b++)
+                coarse->weight[a][b] = 0.0;
+        for (int i = 0; i < level->n; i++)
+            for (int j = 0; j < level->n; j++)
+                coarse->weight[id[shared->community[i]]][id[shared->community[j]]] += level->weight[i][j];
+        _levelDegrees(coarse);
+
+        louvainLevel *tmp = level;
+        level = coarse;
+        coarse = tmp;
+        shared->level = level;
+    }
+
+    result->n = g->n;
+    result->count = 0;
+    for (int v = 0; v < g->n; v++)
+        if (result->community[v] + 1 > result->count)
+            result->count = result->community[v] + 1;
+    result->modularity = modularity(g, result->community);
+    result->version = g->version;
+
+    free(coarse);
+    free(level);
+    free(shared);
+    return result->count;
+}
+
+// Modularity of a Partition of the Graph, Edges taken as undirected
+double modularity(Graph *g, int community[])
+{
+    louvainLevel *level = (louvainLevel *)malloc(sizeof(louvainLevel));
+    _levelFromGraph(g, level);
+    double q = _levelModularity(level, community);
+    free(level);
+    return q;
+}
@@ -0,0 +1,23 @@
+#ifndef _LOUVAIN_H_
+#define _LOUVAIN_H_
+
+#include "graph.h"
+
+#define LOUVAIN_MAX_SWEEPS 32
+#define LOUVAIN_TOLERANCE 1e-7
+
+// Communities found by Louvain Modularity Optimization, Edges taken as undirected
+typedef struct communityResult_t {
+    unsigned int version;         // Graph Version the Communities were found for (0 if never computed)
+    int n;                        // Number of Vertices
+    int community[MAX_VERTICES];  // Community of each Vertex, from 0 to count - 1
+    int count;                    // Number of Communities
+    double modularity;            // Modularity of the Partition
+    int levels;                   // Aggregation Levels run
+} CommunityResult;
+
+void communityResultInit(CommunityResult *result);
+int louvainCommunities(Graph *g, int threadCount, CommunityResult *result);
+double modularity(Graph *g, int community[]);
+
+#endif
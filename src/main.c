@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <string.h>
 #include <pthread.h>
 
 #include "raylib.h"
@@ -6,9 +7,27 @@
 #include "raygui.h"
 
 #include "csv.h"
+#include "diameter.h"
+#include "edgeMesh.h"
+#include "forceLayout.h"
+#include "frameProfiler.h"
 #include "graph.h"
+#include "graphStore.h"
+#include "kCore.h"
+#include "kShortestPaths.h"
+#include "louvain.h"
+#include "matrixView.h"
+#include "maxFlow.h"
+#include "pageRank.h"
+#include "parallel.h"
 #include "priorityQueue.h"
+#include "reachability.h"
+#include "reorder.h"
+#include "spanningTree.h"
+#include "spatialIndex.h"
+#include "staticLayer.h"
 #include "threading.h"
+#include "trace.h"
 #include "utils.h"
 
 // Screen Size
@@ -24,6 +43,11 @@ const int polygonRadius = 200;
 const int bfsOffset = halfScreenHeight - 12;
 const int dfsOffset = halfScreenHeight + 24;
 const int dijkstraOffset = halfScreenHeight - 48;
+const float cullMargin = 48.0f;
+const float minimumZoom = 0.05f;
+const float maximumZoom = 8.0f;
+const char *traceFilePath = "trace.json";
+const double traceSavedSeconds = 3.0;
 
 // Static Variables
 
@@ -39,6 +63,18 @@ typedef enum sceneType {
     MAIN_SCENE,          // Main Scene
 } SceneType;
 
+// Everything the Static Layer of the Main Scene shows, compared Byte by Byte to decide when to redraw it
+typedef struct mainSceneKey_t {
+    unsigned int graphVersion;         // Graph Version
+    unsigned int pageRankVersion;      // Graph Version of the PageRank Scores (0 if not shown)
+    unsigned int communityVersion;     // Graph Version of the Communities (0 if not shown)
+    int pointCount;                    // Point Count
+    float thickness;                   // Edge Thickness
+    Camera2D camera;                   // Pan and Zoom
+    Vector2 points[MAX_VERTICES];      // Point Positions
+    bool hidden[MAX_VERTICES];         // Vertices outside the Minimum Core
+} MainSceneKey;
+
 //------------------------------------------------------------------------------------
 // All the Scenes
 
@@ -46,6 +82,11 @@ void startMenu(
     SceneType *currentScene, // Current Scene
     bool *exitWindow         // Exit Window Flag
 );
+void drawFrameProfile(
+    FrameProfiler *profiler, // Frame Profiler
+    int x,                   // Left of the Overlay
+    int y                    // Top of the Overlay
+);
 void mainScene(
     Vector2 *points,                   // Points Array
     Graph *theGraph,                   // Graph
@@ -56,6 +97,30 @@ void mainScene(
     dfsThreadData *dfsData,            // DFS Thread Data
     dijkstraThreadData *dijkstraData,  // Dijkstra Thread Data
     bool *adjacencyMatrixWindowActive, // Adjacency Matrix Window Active Flag
+    MatrixView *matrixView,            // Scroll Position and Heatmap of the Adjacency Matrix Window
+    SpanningForest *spanningForest,    // Minimum Spanning Forest
+    bool *spanningTreeActive,          // Spanning Tree Active Flag
+    PageRankResult *pageRankResult,    // PageRank Scores
+    bool *pageRankActive,              // PageRank Active Flag
+    CoreResult *coreResult,            // Core Numbers
+    float *minimumCore,                // Minimum Core of drawn Vertices
+    CommunityResult *communityResult,  // Louvain Communities
+    bool *communitiesActive,           // Communities Active Flag
+    PathSet *pathSet,                  // K Shortest Paths between the Dijkstra Labels
+    int *pathIndex,                    // Index of the drawn Path (-1 if hidden)
+    FlowResult *flowResult,            // Maximum Flow between the Dijkstra Labels
+    bool *minimumCutActive,            // Minimum Cut Active Flag
+    EccentricityResult *eccentricity,  // Diameter and Radius
+    float *neighbourhoodHops,          // Hops kept when opening a Neighbourhood
+    EdgeMesh *edgeMesh,                // Cached Edge Geometry
+    int *hoveredEdge,                  // Edge under the Cursor as From and To Vertices (-1 if none)
+    SpatialIndex *spatialIndex,        // Grid over the Points and Edges, used to cull what is out of View
+    StaticLayer *staticLayer,          // Texture holding the Edges and Vertices between Changes
+    Camera2D *camera,                  // Pan and Zoom of the Graph
+    FrameProfiler *profiler,           // Timers for the Phases of the Frame
+    int layoutIterations,              // Layout Iterations applied to the Points
+    float layoutTemperature,           // Layout Step Size after those Iterations
+    atomic_bool *layoutActive,         // Layout Active Flag
     float *edgeThickness,              // Edge Thickness
     bool debugInfoActive               // Debug Information Active Flag
 );
@@ -71,6 +136,10 @@ int main(void)
 
     SetConfigFlags(FLAG_VSYNC_HINT | FLAG_MSAA_4X_HINT);
     InitWindow(screenWidth, screenHeight, "Graph Project 4 - Output and Display");
+    StaticLayer staticLayer;
+    staticLayerInit(&staticLayer, screenWidth, screenHeight);
+    MatrixView matrixView;
+    matrixViewInit(&matrixView);
 
     // Scene Configuration
 
@@ -83,7 +152,11 @@ int main(void)
     int pointCount = 6;
     int selectedPoint = -1;
     int focusedPoint = -1;
+    int hoveredEdge[2] = {-1, -1};
     float edgeThickness = 4.0f;
+    Camera2D camera = {{0, 0}, {0, 0}, 0.0f, 1.0f};
+    FrameProfiler profiler;
+    profilerInit(&profiler);
 
     Vector2 points[MAX_VERTICES];
     createPointPolygon(points, pointCount, (Vector2){halfScreenWidth, halfScreenHeight}, polygonRadius);
@@ -101,7 +174,41 @@ int main(void)
         addEdge(&theGraph, "E", "F");
         addEdge(&theGraph, "F", "A");
     }
+    GraphStore graphStore;
+    graphStoreInit(&graphStore, &theGraph);
     priorityQueue pQueue;
+    ReachabilityIndex reachability;
+    reachabilityInit(&reachability);
+    SpanningForest spanningForest;
+    spanningForestInit(&spanningForest);
+    PageRankResult pageRankResult;
+    pageRankInit(&pageRankResult);
+    CoreResult coreResult;
+    coreResultInit(&coreResult);
+    float minimumCore = 0.0f;
+    float neighbourhoodHops = 2.0f;
+    EdgeMesh edgeMesh;
+    edgeMeshInit(&edgeMesh);
+    SpatialIndex spatialIndex;
+    spatialIndexInit(&spatialIndex, SPATIAL_CELL_SIZE);
+    CommunityResult communityResult;
+    communityResultInit(&communityResult);
+    PathSet pathSet;
+    pathSetInit(&pathSet);
+    int pathIndex = -1;
+    FlowResult flowResult;
+    flowResultInit(&flowResult);
+    EccentricityResult eccentricity;
+    eccentricityInit(&eccentricity);
+    ForceLayout forceLayout;
+    Vector2 layoutPositions[MAX_VERTICES];
+    int layoutIterations = 0, appliedLayoutIterations = 0;
+    float layoutTemperature = 0.0f, appliedLayoutTemperature = 0.0f;
+    int layoutPinned = -1;
+    Vector2 layoutPinnedPosition = {0, 0};
+    unsigned int layoutGraphVersion = 0;
+    double traceSavedTime = -1.0;
+    int traceSavedDropped = 0;
     bool visitedVertices[MAX_VERTICES];
     int dsArray1[MAX_VERTICES], dsArray2[MAX_VERTICES], dsArray3[MAX_VERTICES], dsArray4[MAX_VERTICES];
     int dsVar1, dsVar2;
@@ -132,9 +239,15 @@ int main(void)
     // Windows Configuration
 
     bool adjacencyMatrixWindowActive = false;
-    bool bfsActive = false;
-    bool dfsActive = false;
-    bool dijkstraActive = false;
+    bool spanningTreeActive = false;
+    bool pageRankActive = false;
+    bool communitiesActive = false;
+    bool minimumCutActive = false;
+    atomic_bool bfsActive = false;
+    atomic_bool dfsActive = false;
+    atomic_bool dijkstraActive = false;
+    atomic_bool layoutActive = false;
+    bool layoutStarted = false;
 
     // Threading Configuration
 
@@ -142,16 +255,22 @@ int main(void)
     pthread_t bfsThreadID = PTHREAD_ONCE_INIT;
     pthread_t dfsThreadID = PTHREAD_ONCE_INIT;
     pthread_t dijkstraThreadID = PTHREAD_ONCE_INIT;
+    pthread_t layoutThreadID = PTHREAD_ONCE_INIT;
+    pthread_mutex_t layoutLock = PTHREAD_MUTEX_INITIALIZER;
+    SnapshotBuffer algorithmSnapshots;
+    snapshotInit(&algorithmSnapshots);
 
-    ThreadStatus csvStatus = NOT_STARTED;
-    ThreadStatus bfsStatus = NOT_STARTED;
-    ThreadStatus dfsStatus = NOT_STARTED;
-    ThreadStatus dijkstraStatus = NOT_STARTED;
+    AtomicThreadStatus csvStatus = NOT_STARTED;
+    AtomicThreadStatus bfsStatus = NOT_STARTED;
+    AtomicThreadStatus dfsStatus = NOT_STARTED;
+    AtomicThreadStatus dijkstraStatus = NOT_STARTED;
+    AtomicThreadStatus layoutStatus = NOT_STARTED;
 
     csvThreadData csvData = {&csvStatus, csvFilePath, points, &pointCount, (Vector2){halfScreenWidth, halfScreenHeight}, polygonRadius, &theGraph, bfsSrcLabel, dfsSrcLabel, dijkstraSrcLabel, bfsDestLabel, dfsDestLabel, dijkstraDestLabel};
-    bfsThreadData bfsData = {&bfsStatus, &theGraph, bfsSrcLabel, bfsDestLabel, &currentV, &srcV, &destV, dsArray1, &childTop, visitedVertices, dsArray2, &dsVar1, &dsVar2, &bfsActive};
-    dfsThreadData dfsData = {&dfsStatus, &theGraph, dfsSrcLabel, dfsDestLabel, &currentV, &srcV, &destV, dsArray1, &childTop, visitedVertices, dsArray2, &dsVar1, &dfsActive};
-    dijkstraThreadData dijkstraData = {&dijkstraStatus, &theGraph, dijkstraSrcLabel, dijkstraDestLabel, &currentV, &srcV, &destV, dsArray1, &childTop, dsArray2, dsArray3, &pQueue, visitedVertices, dsArray4, &dsVar1, &dijkstraActive};
+    bfsThreadData bfsData = {&bfsStatus, &graphStore, bfsSrcLabel, bfsDestLabel, &currentV, &srcV, &destV, dsArray1, &childTop, visitedVertices, dsArray2, &dsVar1, &dsVar2, &bfsActive, &reachability, &algorithmSnapshots};
+    dfsThreadData dfsData = {&dfsStatus, &graphStore, dfsSrcLabel, dfsDestLabel, &currentV, &srcV, &destV, dsArray1, &childTop, visitedVertices, dsArray2, &dsVar1, &dfsActive, &reachability, &algorithmSnapshots};
+    dijkstraThreadData dijkstraData = {&dijkstraStatus, &graphStore, dijkstraSrcLabel, dijkstraDestLabel, &currentV, &srcV, &destV, dsArray1, &childTop, dsArray2, dsArray3, &pQueue, visitedVertices, dsArray4, &dsVar1, &dijkstraActive, &reachability, &algorithmSnapshots};
+    layoutThreadData layoutData = {&layoutStatus, &forceLayout, &layoutLock, layoutPositions, &layoutIterations, &layoutTemperature, &layoutPinned, &layoutPinnedPosition, &layoutActive};
 
     // Set custom GUI Style
 
@@ -161,11 +280,34 @@ int main(void)
     SetTargetFPS(60);
     //--------------------------------------------------------------------------------------
 
+    traceThreadName("Main");
+
     // Main Loop
     while (!exitWindow)
     {
+        // Start or stop a Trace Capture between Frames, so no Frame is cut in half
+        if (IsKeyPressed(KEY_F2))
+        {
+            if (traceActive())
+            {
+                traceStop();
+                if (traceDump(traceFilePath) == 0)
+                {
+                    traceSavedTime = GetTime();
+                    traceSavedDropped = traceDropped();
+                }
+            }
+            else
+                traceStart();
+        }
+
+        // Time the Frame only while the Debug Information is shown
+        profilerEnable(&profiler, debugInfoActive);
+        profilerBeginFrame(&profiler);
+
         // Update
         //----------------------------------------------------------------------------------
+        profilerBegin(&profiler, PROFILE_UPDATE);
 
         // Detect Window Close button or ESC key
         if (WindowShouldClose())
@@ -181,32 +323,50 @@ int main(void)
             }
             case MAIN_SCENE:
             {
+                // Camera Logic, zooming about the Cursor with the Wheel and panning with the Middle Button
+                float wheel = GetMouseWheelMove();
+                if (wheel != 0.0f && !(adjacencyMatrixWindowActive && CheckCollisionPointRec(GetMousePosition(), matrixView.bounds)))
+                {
+                    camera.target = GetScreenToWorld2D(GetMousePosition(), camera);
+                    camera.offset = GetMousePosition();
+                    camera.zoom *= (wheel > 0.0f) ? 1.125f : 1.0f / 1.125f;
+                    if (camera.zoom < minimumZoom) camera.zoom = minimumZoom;
+                    if (camera.zoom > maximumZoom) camera.zoom = maximumZoom;
+                }
+                if (IsMouseButtonDown(MOUSE_MIDDLE_BUTTON))
+                {
+                    Vector2 delta = GetMouseDelta();
+                    camera.target.x -= delta.x / camera.zoom;
+                    camera.target.y -= delta.y / camera.zoom;
+                }
+                if (IsKeyPressed(KEY_HOME))
+                    camera = (Camera2D){{0, 0}, {0, 0}, 0.0f, 1.0f};
+                Vector2 mouseWorld = GetScreenToWorld2D(GetMousePosition(), camera);
+
                 // Point Creation Logic
                 if (IsMouseButtonPressed(MOUSE_RIGHT_BUTTON) && (pointCount < MAX_VERTICES) && (focusedPoint == -1) && (!adjacencyMatrixWindowActive))
                 {
                     if (addVertex(&theGraph, (char *)TextFormat("%c", 65 + pointCount)) == 0)
                     {
-                        points[pointCount] = GetMousePosition();
+                        points[pointCount] = mouseWorld;
                         pointCount++;
                     }
                 }
 
                 // Point Focus and Selection Logic
-                for (int i = 0; i < pointCount; i++)
-                {
-                    if (CheckCollisionPointCircle(GetMousePosition(), points[i], 24.0f))
-                    {
-                        focusedPoint = i;
-                        if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) selectedPoint = i; 
-                        break;
-                    }
-                    else focusedPoint = -1;
-                }
+                spatialIndexSync(&spatialIndex, &theGraph, points, pointCount);
+                focusedPoint = spatialVertexAt(&spatialIndex, mouseWorld, 24.0f);
+                if (focusedPoint != -1 && IsMouseButtonDown(MOUSE_LEFT_BUTTON)) selectedPoint = focusedPoint;
+
+                // Edge Picking Logic, with a Tolerance of a few Pixels on Screen
+                if (focusedPoint != -1 || !spatialEdgeAt(&spatialIndex, mouseWorld, 6.0f / camera.zoom, &hoveredEdge[0], &hoveredEdge[1]))
+                    hoveredEdge[0] = hoveredEdge[1] = -1;
 
                 // Point Movement Logic
                 if (selectedPoint >= 0)
                 {
-                    points[selectedPoint] = GetMousePosition();
+                    points[selectedPoint] = mouseWorld;
+                    spatialIndexMove(&spatialIndex, &theGraph, selectedPoint, points[selectedPoint]);
                     if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) selectedPoint = -1;
                 }
 
@@ -228,6 +388,83 @@ int main(void)
                     UnloadDroppedFiles(droppedFiles);
                 }
 
+                // Neighbourhood Logic, replacing the Graph with the Ball around the focused Point
+                if (
+                    IsKeyPressed(KEY_N) && (focusedPoint != -1) && (selectedPoint == -1) &&
+                    !bfsActive && !dfsActive && !dijkstraActive && csvStatus != IN_PROGRESS
+                )
+                {
+                    int ball[MAX_VERTICES], ballHops[MAX_VERTICES];
+                    int ballCount = bfsBall(&theGraph, focusedPoint, (int)neighbourhoodHops, ball, ballHops);
+
+                    Graph neighbourhood;
+                    if (inducedSubgraph(&theGraph, ball, ballCount, &neighbourhood) == 0)
+                    {
+                        graphDeinit(&theGraph);
+                        theGraph = neighbourhood;
+                        pointCount = theGraph.n;
+                        focusedPoint = -1;
+                        createPointPolygon(points, pointCount, (Vector2){halfScreenWidth, halfScreenHeight}, polygonRadius);
+
+                        TextCopy(bfsSrcLabel, theGraph.labels[0]);
+                        TextCopy(dfsSrcLabel, theGraph.labels[0]);
+                        TextCopy(dijkstraSrcLabel, theGraph.labels[0]);
+                        TextCopy(bfsDestLabel, theGraph.labels[theGraph.n - 1]);
+                        TextCopy(dfsDestLabel, theGraph.labels[theGraph.n - 1]);
+                        TextCopy(dijkstraDestLabel, theGraph.labels[theGraph.n - 1]);
+                    }
+                }
+
+                // Layout Logic, starting the Layout Thread from the current Points and stopping it if the Graph changes
+                if (layoutActive && (csvStatus == IN_PROGRESS || (layoutStatus == IN_PROGRESS && theGraph.version != layoutGraphVersion)))
+                    layoutActive = false;
+                bool layoutDone = layoutStarted && layoutStatus == COMPLETED;
+
+                // Copy the latest published Layout into the Points, leaving the dragged Point under the Cursor
+                if (layoutStarted && theGraph.version == layoutGraphVersion)
+                {
+                    pthread_mutex_lock(&layoutLock);
+                    layoutPinned = selectedPoint;
+                    if (selectedPoint >= 0)
+                        layoutPinnedPosition = points[selectedPoint];
+                    if (layoutIterations != appliedLayoutIterations)
+                    {
+                        for (int i = 0; i < pointCount && i < forceLayout.n; i++)
+                            if (i != selectedPoint)
+                                points[i] = layoutPositions[i];
+                        appliedLayoutIterations = layoutIterations;
+                        appliedLayoutTemperature = layoutTemperature;
+                    }
+                    pthread_mutex_unlock(&layoutLock);
+                }
+
+                // The Layout Thread only reports that it has finished, the Layout is switched off here once it has converged
+                if (layoutDone)
+                {
+                    pthread_join(layoutThreadID, NULL);
+                    layoutStarted = false;
+                    layoutStatus = NOT_STARTED;
+                    if (forceLayout.converged)
+                        layoutActive = false;
+                }
+                if (layoutActive && layoutStatus != IN_PROGRESS)
+                {
+                    if (layoutStarted)
+                        pthread_join(layoutThreadID, NULL);
+                    forceLayoutInit(&forceLayout, &theGraph, points, pointCount, (Vector2){halfScreenWidth, halfScreenHeight}, polygonRadius);
+                    layoutGraphVersion = theGraph.version;
+                    layoutIterations = appliedLayoutIterations = 0;
+                    layoutTemperature = appliedLayoutTemperature = forceLayout.temperature;
+                    layoutPinned = -1;
+                    layoutStatus = IN_PROGRESS;
+                    layoutStarted = (pthread_create(&layoutThreadID, NULL, layoutThread, (void *)&layoutData) == 0);
+                    if (!layoutStarted)
+                    {
+                        layoutStatus = NOT_STARTED;
+                        layoutActive = false;
+                    }
+                }
+
                 // Animation Logic
                 if (csvStatus == IN_PROGRESS)
                 {
@@ -235,20 +472,44 @@ int main(void)
                     dfsActive = false;
                     dijkstraActive = false;
                 }
-                if (bfsActive && !dfsActive && !dijkstraActive && bfsStatus != IN_PROGRESS)
+                else
                 {
-                    bfsStatus = NOT_STARTED;
-                    pthread_create(&bfsThreadID, NULL, bfsThread, (void *)&bfsData);
+                    // Publish the Edits of the last Frame for Searches started from now on, running ones keep their Version
+                    // While all Versions are held the Edits simply wait for the next Frame
+                    graphStorePublish(&graphStore, &theGraph);
                 }
-                else if (!bfsActive && dfsActive && !dijkstraActive && dfsStatus != IN_PROGRESS)
+                // A Search is marked in Progress before its Thread starts and none starts while another runs, as they share
+                // the Snapshots and Arrays, so a Worker never finds them reset or written by a second Worker
+                bool searchRunning = bfsStatus == IN_PROGRESS || dfsStatus == IN_PROGRESS || dijkstraStatus == IN_PROGRESS;
+                if (bfsActive && !dfsActive && !dijkstraActive && !searchRunning)
                 {
-                    dfsStatus = NOT_STARTED;
-                    pthread_create(&dfsThreadID, NULL, dfsThread, (void *)&dfsData);
+                    snapshotInit(&algorithmSnapshots);
+                    bfsStatus = IN_PROGRESS;
+                    if (pthread_create(&bfsThreadID, NULL, bfsThread, (void *)&bfsData) != 0)
+                    {
+                        bfsStatus = NOT_STARTED;
+                        bfsActive = false;
+                    }
                 }
-                else if (!bfsActive && !dfsActive && dijkstraActive && dijkstraStatus != IN_PROGRESS)
+                else if (!bfsActive && dfsActive && !dijkstraActive && !searchRunning)
                 {
-                    dijkstraStatus = NOT_STARTED;
-                    pthread_create(&dijkstraThreadID, NULL, dijkstraThread, (void *)&dijkstraData);
+                    snapshotInit(&algorithmSnapshots);
+                    dfsStatus = IN_PROGRESS;
+                    if (pthread_create(&dfsThreadID, NULL, dfsThread, (void *)&dfsData) != 0)
+                    {
+                        dfsStatus = NOT_STARTED;
+                        dfsActive = false;
+                    }
+                }
+                else if (!bfsActive && !dfsActive && dijkstraActive && !searchRunning)
+                {
+                    snapshotInit(&algorithmSnapshots);
+                    dijkstraStatus = IN_PROGRESS;
+                    if (pthread_create(&dijkstraThreadID, NULL, dijkstraThread, (void *)&dijkstraData) != 0)
+                    {
+                        dijkstraStatus = NOT_STARTED;
+                        dijkstraActive = false;
+                    }
                 }
 
                 break;
@@ -260,6 +521,7 @@ int main(void)
         // Toggle Debug Information
         if (IsKeyPressed(KEY_F1))
             debugInfoActive = !debugInfoActive;
+        profilerEnd(&profiler, PROFILE_UPDATE);
 
         // Draw
         //----------------------------------------------------------------------------------
@@ -279,7 +541,10 @@ int main(void)
                     mainScene(
                         points, &theGraph, pointCount, &focusedPoint, &currentScene,
                         &bfsData, &dfsData, &dijkstraData,
-                        &adjacencyMatrixWindowActive, &edgeThickness, debugInfoActive
+                        &adjacencyMatrixWindowActive, &matrixView, &spanningForest, &spanningTreeActive,
+                        &pageRankResult, &pageRankActive, &coreResult, &minimumCore,
+                        &communityResult, &communitiesActive, &pathSet, &pathIndex,
+                        &flowResult, &minimumCutActive, &eccentricity, &neighbourhoodHops, &edgeMesh, hoveredEdge, &spatialIndex, &staticLayer, &camera, &profiler, appliedLayoutIterations, appliedLayoutTemperature, &layoutActive, &edgeThickness, debugInfoActive
                     );
                     break;
                 }
@@ -294,18 +559,54 @@ int main(void)
 
                 Vector2 mousePos = GetMousePosition();
                 DrawText(TextFormat("(%.2f, %.2f)", mousePos.x, mousePos.y), mousePos.x + 15, mousePos.y + 15, 12, BLACK);
+
+                drawFrameProfile(&profiler, screenWidth - 372, screenHeight - 210);
+            }
+
+            // Draw Trace Capture Indicator, then where the last Capture was saved for a few Seconds
+            if (traceActive())
+                DrawText("Tracing (F2 to save)", screenWidth - 190, 34, 16, RED);
+            else if (traceSavedTime >= 0.0 && GetTime() - traceSavedTime < traceSavedSeconds)
+            {
+                const char *traceSaved = TextFormat("Trace saved to %s, %i Events dropped", traceFilePath, traceSavedDropped);
+                DrawText(traceSaved, screenWidth - MeasureText(traceSaved, 16) - 10, 34, 16, DARKGREEN);
             }
 
+        profilerBegin(&profiler, PROFILE_END_DRAWING);
         EndDrawing();
+        profilerEnd(&profiler, PROFILE_END_DRAWING);
+        profilerEndFrame(&profiler);
         //----------------------------------------------------------------------------------
     }
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    staticLayerDeinit(&staticLayer);
+    matrixViewDeinit(&matrixView);
     CloseWindow();        // Close window and OpenGL context
 
+    // Stop the Layout Thread before the Data it writes goes away
+    layoutActive = false;
+    if (layoutStarted)
+        pthread_join(layoutThreadID, NULL);
+
+    // Save a Trace Capture still running
+    if (traceActive())
+    {
+        traceStop();
+        traceDump(traceFilePath);
+    }
+
+    // A Search still running keeps reading its pinned Version and may still record Events, so the Store and the Trace Buffers are left to the Process Exit
+    if (bfsStatus != IN_PROGRESS && dfsStatus != IN_PROGRESS && dijkstraStatus != IN_PROGRESS)
+    {
+        graphStoreDeinit(&graphStore);
+        traceDeinit();
+    }
     graphDeinit(&theGraph);
     pQueueDeinit(&pQueue);
+    edgeMeshDeinit(&edgeMesh);
+    spatialIndexDeinit(&spatialIndex);
 
     RL_FREE(csvFilePath);
     RL_FREE(bfsSrcLabel);
@@ -336,48 +637,461 @@ void startMenu(SceneType *currentScene, bool *exitWindow)
 }
 //----------------------------------------------------------------------------------
 
+// Draw the Time of each Phase with its Percentiles, and a Sparkline of the recorded Frames
+//----------------------------------------------------------------------------------
+void drawFrameProfile(FrameProfiler *profiler, int x, int y)
+{
+    int count = profilerFrameCount(profiler);
+    if (count == 0)
+        return;
+
+    DrawRectangle(x - 6, y - 6, PROFILE_FRAMES + 132, 14 * (PROFILE_PHASES + 2) + 54, Fade(RAYWHITE, 0.85f));
+    DrawText("Phase           Last     p50     p99 (ms)", x, y, 10, BLACK);
+    for (int phase = 0; phase <= PROFILE_PHASES; phase++)
+    {
+        float last = (phase == PROFILE_PHASES) ? profilerFrame(profiler, 0) : profiler->phaseSeconds[(profiler->frames - 1) % PROFILE_FRAMES][phase];
+        DrawText(TextFormat("%-12s %7.2f %7.2f %7.2f", profilerPhaseName(phase), last * 1000.0f,
+            profilerPercentile(profiler, phase, 0.5f) * 1000.0f, profilerPercentile(profiler, phase, 0.99f) * 1000.0f),
+            x, y + 14 * (phase + 1), 10, (phase == PROFILE_PHASES) ? BLACK : DARKGRAY);
+    }
+
+    // Frame Times as Bars, the newest on the Right, scaled so a 60 FPS Frame reaches Half Way
+    int top = y + 14 * (PROFILE_PHASES + 2), height = 40;
+    float scale = height / (2.0f / 60.0f);
+    DrawRectangleLines(x, top, PROFILE_FRAMES, height, LIGHTGRAY);
+    DrawLine(x, top + height / 2, x + PROFILE_FRAMES, top + height / 2, LIGHTGRAY);
+    for (int age = 0; age < count; age++)
+    {
+        int bar = (int)(profilerFrame(profiler, age) * scale);
+        if (bar > height)
+            bar = height;
+        DrawLine(x + PROFILE_FRAMES - 1 - age, top + height, x + PROFILE_FRAMES - 1 - age, top + height - bar, (bar >= height / 2) ? MAROON : DARKGREEN);
+    }
+}
+//----------------------------------------------------------------------------------
+
+// Colour of a Vertex, by PageRank Score or Community when either is shown
+//----------------------------------------------------------------------------------
+static Color vertexColor(int vertex, bool focused, bool pageRankActive, PageRankResult *pageRankResult, bool communitiesActive, CommunityResult *communityResult)
+{
+    Color color = focused ? GRAY : LIGHTGRAY;
+
+    // Colour Vertices from Blue to Red by PageRank Score
+    if (pageRankActive && vertex < pageRankResult->n && pageRankResult->maxRank > 0.0f)
+        color = ColorFromHSV(220.0f * (1.0f - pageRankResult->rank[vertex] / pageRankResult->maxRank), 0.5f, focused ? 0.7f : 0.95f);
+
+    // Colour Vertices by Community, spreading Hues by the Golden Angle
+    if (communitiesActive && vertex < communityResult->n)
+        color = ColorFromHSV((float)((communityResult->community[vertex] * 137) % 360), 0.45f, focused ? 0.7f : 0.95f);
+
+    return color;
+}
+//----------------------------------------------------------------------------------
+
 // Draw Main Scene
 //----------------------------------------------------------------------------------
 void mainScene(Vector2 *points, Graph *theGraph, int pointCount, int *focusedPoint, SceneType *currentScene,
                bfsThreadData *bfsData, dfsThreadData *dfsData, dijkstraThreadData *dijkstraData,
-               bool *adjacencyMatrixWindowActive, float *edgeThickness, bool debugInfoActive)
+               bool *adjacencyMatrixWindowActive, MatrixView *matrixView, SpanningForest *spanningForest, bool *spanningTreeActive,
+               PageRankResult *pageRankResult, bool *pageRankActive, CoreResult *coreResult, float *minimumCore,
+               CommunityResult *communityResult, bool *communitiesActive, PathSet *pathSet, int *pathIndex,
+               FlowResult *flowResult, bool *minimumCutActive, EccentricityResult *eccentricity,
+               float *neighbourhoodHops, EdgeMesh *edgeMesh, int *hoveredEdge, SpatialIndex *spatialIndex,
+               StaticLayer *staticLayer, Camera2D *camera, FrameProfiler *profiler, int layoutIterations, float layoutTemperature, atomic_bool *layoutActive, float *edgeThickness, bool debugInfoActive)
 {
-    // Draw Edges
-    for (int i = 0; i < pointCount; i++)
+    // Compute Core Numbers
+    if (coreResult->version != theGraph->version)
+    {
+        if (theGraph->n >= KCORE_PARALLEL_MIN_VERTICES)
+            parallelCoreDecomposition(theGraph, parallelThreadCount(), coreResult);
+        else
+            coreDecomposition(theGraph, coreResult);
+        if (*minimumCore > coreResult->maxCore)
+            *minimumCore = (float)coreResult->maxCore;
+    }
+
+    // Hide Vertices outside the Minimum Core
+    bool hidden[MAX_VERTICES] = {false};
+    for (int i = 0; i < pointCount && i < coreResult->n; i++)
+        hidden[i] = (coreResult->core[i] < (int)(*minimumCore));
+
+    // Find the Vertices and Edges in View, with a Margin for Vertex Circles and Weight Labels
+    // The Graph may have been replaced since the Update, so the Index is brought up to date first
+    spatialIndexSync(spatialIndex, theGraph, points, pointCount);
+    Vector2 viewStart = GetScreenToWorld2D((Vector2){0, 0}, *camera);
+    Vector2 viewEnd = GetScreenToWorld2D((Vector2){screenWidth, screenHeight}, *camera);
+    Rectangle view = {viewStart.x - cullMargin, viewStart.y - cullMargin, viewEnd.x - viewStart.x + 2 * cullMargin, viewEnd.y - viewStart.y + 2 * cullMargin};
+    int visibleVertices[MAX_VERTICES], visibleEdges[MAX_VERTICES * MAX_VERTICES];
+    int visibleVertexCount = spatialVerticesInRect(spatialIndex, view, visibleVertices);
+    int visibleEdgeCount = spatialEdgesInRect(spatialIndex, view, visibleEdges);
+    bool detailed = camera->zoom >= EDGE_MESH_DETAIL_ZOOM;
+
+    // Self Loops are not indexed, they are in View with their Vertex
+    for (int k = 0; k < visibleVertexCount; k++)
+        if (theGraph->adj[visibleVertices[k]][visibleVertices[k]] >= 1)
+            visibleEdges[visibleEdgeCount++] = visibleVertices[k] * MAX_VERTICES + visibleVertices[k];
+
+    // Compute PageRank Scores
+    if (*pageRankActive && pageRankResult->version != theGraph->version)
+        pageRank(theGraph, PAGERANK_DAMPING, PAGERANK_TOLERANCE, (theGraph->n >= PAGERANK_PARALLEL_MIN_VERTICES) ? parallelThreadCount() : 1, pageRankResult);
+
+    // Compute Communities
+    if (*communitiesActive && communityResult->version != theGraph->version)
+        louvainCommunities(theGraph, parallelThreadCount(), communityResult);
+
+    // Compute Minimum Spanning Tree
+    if (*spanningTreeActive && spanningForest->version != theGraph->version)
+        minimumSpanningForest(theGraph, true, spanningForest);
+
+    // Compute K Shortest Paths
+    if (*pathIndex != -1)
+    {
+        int src = findVertex(theGraph, dijkstraData->srcLabel), dest = findVertex(theGraph, dijkstraData->destLabel);
+
+        if (src == -1 || dest == -1)
+            pathSetInit(pathSet);
+        else if (pathSet->version != theGraph->version || pathSet->src != src || pathSet->dest != dest)
+        {
+            kShortestPaths(theGraph, src, dest, MAX_K_PATHS, parallelThreadCount(), pathSet);
+            *pathIndex = 0;
+        }
+    }
+
+    // Compute Minimum Cut
+    if (*minimumCutActive)
+    {
+        int src = findVertex(theGraph, dijkstraData->srcLabel), sink = findVertex(theGraph, dijkstraData->destLabel);
+
+        if (src == -1 || sink == -1 || src == sink)
+            flowResultInit(flowResult);
+        else if (flowResult->version != theGraph->version || flowResult->src != src || flowResult->sink != sink)
+        {
+            if (theGraph->n >= FLOW_PARALLEL_MIN_VERTICES)
+                parallelMaxFlow(theGraph, src, sink, parallelThreadCount(), flowResult);
+            else
+                maxFlow(theGraph, src, sink, flowResult);
+        }
+    }
+
+    bool bfsShown = *(bfsData->animationActive) && !(*(dfsData->animationActive)) && !(*(dijkstraData->animationActive)) && *(bfsData->status) == IN_PROGRESS;
+    bool dfsShown = !(*(bfsData->animationActive)) && *(dfsData->animationActive) && !(*(dijkstraData->animationActive)) && *(dfsData->status) == IN_PROGRESS;
+    bool dijkstraShown = !(*(bfsData->animationActive)) && !(*(dfsData->animationActive)) && *(dijkstraData->animationActive) && *(dijkstraData->status) == IN_PROGRESS;
+    int dijkstraPathLength = -1;
+
+    // Latest Step published by the running Search, which its Thread never writes while it is drawn
+    AlgorithmSnapshot *state = snapshotRead(bfsData->snapshots);
+
+    // Redraw the Static Layer, the visible Edges and Vertices, only when something it shows has changed
+    MainSceneKey key;
+    memset(&key, 0, sizeof(key));
+    key.graphVersion = theGraph->version;
+    key.pageRankVersion = (*pageRankActive) ? pageRankResult->version : 0;
+    key.communityVersion = (*communitiesActive) ? communityResult->version : 0;
+    key.pointCount = pointCount;
+    key.thickness = *edgeThickness;
+    key.camera = *camera;
+    memcpy(key.points, points, pointCount * sizeof(Vector2));
+    memcpy(key.hidden, hidden, pointCount * sizeof(bool));
+    if (staticLayerBegin(staticLayer, &key, sizeof(key)))
+    {
+        ClearBackground(RAYWHITE);
+        BeginMode2D(*camera);
+
+        // Draw visible Edges, Arrows and Edge Weights from the cached Geometry
+        profilerBegin(profiler, PROFILE_EDGES);
+        edgeMeshUpdate(edgeMesh, theGraph, points, pointCount, hidden, *edgeThickness);
+        edgeMeshDraw(edgeMesh, visibleEdges, visibleEdgeCount, camera->zoom, SKYBLUE, BLACK);
+        profilerEnd(profiler, PROFILE_EDGES);
+
+        // Draw visible Vertices and, when zoomed in enough to read them, their Labels
+        profilerBegin(profiler, PROFILE_VERTICES);
+        for (int k = 0; k < visibleVertexCount; k++)
+        {
+            int i = visibleVertices[k];
+            if (i >= pointCount || hidden[i])
+                continue;
+
+            DrawCircleV(points[i], 24.0f, vertexColor(i, false, *pageRankActive, pageRankResult, *communitiesActive, communityResult));
+            if (!detailed)
+                continue;
+            DrawText(TextFormat("%s", (*theGraph).labels[i]), points[i].x - 5, points[i].y - 5, 15, BLACK);
+            if (*pageRankActive && i < pageRankResult->n)
+                DrawText(TextFormat("%.3f", pageRankResult->rank[i]), points[i].x - 13, points[i].y + 10, 10, DARKGRAY);
+        }
+        profilerEnd(profiler, PROFILE_VERTICES);
+
+        EndMode2D();
+        staticLayerEnd(staticLayer);
+    }
+    staticLayerDraw(staticLayer);
+
+    // Draw the Overlays in World Space
+    //----------------------------------------------------------------------------------
+    BeginMode2D(*camera);
+
+    // Draw Hovered Edge
+    if (hoveredEdge[0] != -1 && hoveredEdge[0] < pointCount && hoveredEdge[1] < pointCount && !hidden[hoveredEdge[0]] && !hidden[hoveredEdge[1]])
+    {
+        DrawLineEx(points[hoveredEdge[0]], points[hoveredEdge[1]], *edgeThickness, ORANGE);
+        drawArrow(points[hoveredEdge[0]], points[hoveredEdge[1]], ORANGE);
+    }
+
+    // Draw Focused Vertex
+    if (*focusedPoint >= 0 && *focusedPoint < pointCount && !hidden[*focusedPoint])
+    {
+        int i = *focusedPoint;
+        DrawCircleV(points[i], 30.0f, vertexColor(i, true, *pageRankActive, pageRankResult, *communitiesActive, communityResult));
+        DrawText(TextFormat("%s", (*theGraph).labels[i]), points[i].x - 5, points[i].y - 5, 15, BLACK);
+        if (*pageRankActive && i < pageRankResult->n)
+            DrawText(TextFormat("%.3f", pageRankResult->rank[i]), points[i].x - 13, points[i].y + 10, 10, DARKGRAY);
+    }
+
+    // Draw Minimum Spanning Tree
+    if (*spanningTreeActive)
+    {
+        for (int k = 0; k < spanningForest->edgeCount; k++)
+        {
+            int from = spanningForest->from[k], to = spanningForest->to[k];
+            DrawLineEx(points[from], points[to], *edgeThickness, GRAY);
+            drawArrow(points[from], points[to], GRAY);
+            DrawCircleV(points[from], (*focusedPoint == from)? 30.0f : 24.0f, (*focusedPoint == from)? GRAY: LIGHTGRAY);
+            DrawText(TextFormat("%s", (*theGraph).labels[from]), points[from].x - 5, points[from].y - 5, 15, BLACK);
+            DrawCircleV(points[to], (*focusedPoint == to)? 30.0f : 24.0f, (*focusedPoint == to)? GRAY: LIGHTGRAY);
+            DrawText(TextFormat("%s", (*theGraph).labels[to]), points[to].x - 5, points[to].y - 5, 15, BLACK);
+        }
+    }
+
+    // Draw K Shortest Paths
+    if (*pathIndex != -1 && *pathIndex < pathSet->count)
+    {
+        int *path = pathSet->vertices[*pathIndex];
+        for (int i = 0; i < pathSet->hops[*pathIndex] - 1; i++)
+        {
+            DrawLineEx(points[path[i]], points[path[i + 1]], *edgeThickness, BLACK);
+            drawArrow(points[path[i]], points[path[i + 1]], BLACK);
+        }
+        for (int i = 0; i < pathSet->hops[*pathIndex]; i++)
+        {
+            DrawCircleV(points[path[i]], (*focusedPoint == path[i])? 30.0f : 24.0f, (*focusedPoint == path[i])? GRAY: LIGHTGRAY);
+            DrawText(TextFormat("%s", (*theGraph).labels[path[i]]), points[path[i]].x - 5, points[path[i]].y - 5, 15, BLACK);
+        }
+        DrawRing(points[path[0]], 24.0f, 26.0f, 0, 360, 90, RED);
+        DrawRing(points[path[pathSet->hops[*pathIndex] - 1]], 24.0f, 26.0f, 0, 360, 90, GREEN);
+    }
+
+    // Draw Minimum Cut Edges, and Source Side Vertices with Red Rings and Sink Side Vertices with Green Rings
+    if (*minimumCutActive)
+    {
+        for (int i = 0; i < flowResult->n && i < pointCount; i++)
+        {
+            for (int j = 0; j < flowResult->n && j < pointCount; j++)
+                if (flowResult->sourceSide[i] && !flowResult->sourceSide[j] && theGraph->adj[i][j] > 0 && !hidden[i] && !hidden[j])
+                {
+                    DrawLineEx(points[i], points[j], *edgeThickness, MAROON);
+                    drawArrow(points[i], points[j], MAROON);
+                }
+            if (!hidden[i])
+                DrawRing(points[i], 24.0f, 26.0f, 0, 360, 90, flowResult->sourceSide[i] ? RED : GREEN);
+        }
+    }
+
+    // Draw Algorithm States on the Vertices
+    profilerBegin(profiler, PROFILE_ALGORITHM);
+    if (bfsShown)
+    {
+        // Draw Visited Vertices
+        for (int i = 0; i < pointCount; i++)
+            if (state->visited[i])
+                DrawRing(points[i], 24.0f, 26.0f, 0, 360, 90, BLACK);
+
+        // Draw Queue Vertices
+        for (int i = state->front; i < state->rear; i++)
+            DrawRing(points[state->items[i]], 24.0f, 26.0f, 0, 360, 90, YELLOW);
+
+        // Draw Children Vertices
+        for (int i = 0; i < state->childrenTop; i++)
+            DrawRing(points[state->children[i]], 24.0f, 26.0f, 0, 360, 90, BLUE);
+
+        // Draw Current, Source and Destination Vertices
+        if (state->current != -1)
+            DrawRing(points[state->current], 24.0f, 26.0f, 0, 360, 90, ORANGE);
+        if (state->src != -1)
+            DrawRing(points[state->src], 24.0f, 26.0f, 0, 360, 90, RED);
+        if (state->dest != -1)
+            DrawRing(points[state->dest], 24.0f, 26.0f, 0, 360, 90, GREEN);
+    }
+    else if (dfsShown)
     {
-        for (int j = 0; j < pointCount; j++)
+        // Draw Visited Vertices
+        for (int i = 0; i < pointCount; i++)
+            if (state->visited[i])
+                DrawRing(points[i], 24.0f, 26.0f, 0, 360, 90, BLACK);
+
+        // Draw Stack Vertices
+        for (int i = 0; i < state->rear; i++)
+            DrawRing(points[state->items[i]], 24.0f, 26.0f, 0, 360, 90, YELLOW);
+
+        // Draw Children Vertices
+        for (int i = 0; i < state->childrenTop; i++)
+            DrawRing(points[state->children[i]], 24.0f, 26.0f, 0, 360, 90, BLUE);
+
+        // Draw Current, Source and Destination Vertices
+        if (state->current != -1)
+            DrawRing(points[state->current], 24.0f, 26.0f, 0, 360, 90, ORANGE);
+        if (state->src != -1)
+            DrawRing(points[state->src], 24.0f, 26.0f, 0, 360, 90, RED);
+        if (state->dest != -1)
+            DrawRing(points[state->dest], 24.0f, 26.0f, 0, 360, 90, GREEN);
+    }
+    else if (dijkstraShown)
+    {
+        for (int i = 0; i < pointCount; i++)
         {
-            if ((*theGraph).adj[i][j] >= 1)
+            // Draw Vertex Distances
+            if (state->distance[i] != INT_MAX && state->distance[i] != INT_MIN)
             {
-                // Draw Edge
-                DrawLineEx(points[i], points[j], *edgeThickness, SKYBLUE);
+                DrawText(TextFormat("%d", state->distance[i]), points[i].x + 24, points[i].y + 24, 12, BLACK);
+
+                // Draw Vertex's Parent // TODO: Refactor this to reduce Redundancy
+                if (state->previous[i] != -1)
+                {
+                    DrawLineEx(points[state->previous[i]], points[i], *edgeThickness, GRAY);
+                    drawArrow(points[state->previous[i]], points[i], GRAY);
+                    DrawCircleV(points[i], (*focusedPoint == i)? 30.0f : 24.0f, (*focusedPoint == i)? GRAY: LIGHTGRAY);
+                    DrawText(TextFormat("%s", (*theGraph).labels[i]), points[i].x - 5, points[i].y - 5, 15, BLACK);
+                    DrawCircleV(points[state->previous[i]], (*focusedPoint == state->previous[i])? 30.0f : 24.0f, (*focusedPoint == state->previous[i])? GRAY: LIGHTGRAY);
+                    DrawText(TextFormat("%s", (*theGraph).labels[state->previous[i]]), points[state->previous[i]].x - 5, points[state->previous[i]].y - 5, 15, BLACK);
+                }
+            }
+        }
+
+        // Draw Children Vertices
+        for (int i = 0; i < state->childrenTop; i++)
+            DrawRing(points[state->children[i]], 24.0f, 26.0f, 0, 360, 90, BLUE);
 
-                // Draw Arrow
-                drawArrow(points[i], points[j], SKYBLUE);
+        // Draw Current, Source and Destination Vertices
+        if (state->current != -1)
+            DrawRing(points[state->current], 24.0f, 26.0f, 0, 360, 90, ORANGE);
+        if (state->src != -1)
+            DrawRing(points[state->src], 24.0f, 26.0f, 0, 360, 90, RED);
+        if (state->dest != -1)
+            DrawRing(points[state->dest], 24.0f, 26.0f, 0, 360, 90, GREEN);
 
-                // Draw Edge Weights
-                Vector2 midPoint = {(points[i].x + points[j].x) / 2, (points[i].y + points[j].y) / 2};
-                DrawText(TextFormat("%d", (*theGraph).adj[i][j]), midPoint.x, midPoint.y + 20, 10, BLACK);
+        // Draw Path // TODO: Refactor this to reduce Redundancy
+        if (state->pathHead != MAX_VERTICES && state->path[state->pathHead] == state->src)
+        {
+            int parent, child = state->path[state->pathHead];
+            for (int i = state->pathHead; i < MAX_VERTICES - 1; i++)
+            {
+                parent = state->path[i];
+                child = state->path[i + 1];
+                DrawLineEx(points[parent], points[child], *edgeThickness, BLACK);
+                drawArrow(points[parent], points[child], BLACK);
+                DrawCircleV(points[parent], (*focusedPoint == parent)? 30.0f : 24.0f, (*focusedPoint == parent)? GRAY: LIGHTGRAY);
+                DrawText(TextFormat("%s", (*theGraph).labels[parent]), points[parent].x - 5, points[parent].y - 5, 15, BLACK);
             }
+            DrawCircleV(points[child], (*focusedPoint == child)? 30.0f : 24.0f, (*focusedPoint == child)? GRAY: LIGHTGRAY);
+            DrawText(TextFormat("%s", (*theGraph).labels[child]), points[child].x - 5, points[child].y - 5, 15, BLACK);
+
+            // The Distance the Search found, on the Weights of its Version rather than any edited since
+            dijkstraPathLength = state->distance[child];
         }
     }
 
-    // Draw Vertices and Labels
-    for (int i = 0; i < pointCount; i++)
+    profilerEnd(profiler, PROFILE_ALGORITHM);
+
+    // Draw Point Coordinates
+    if (debugInfoActive)
+        for (int k = 0; k < visibleVertexCount; k++)
+            DrawText(TextFormat("(%.2f, %.2f)", points[visibleVertices[k]].x, points[visibleVertices[k]].y), points[visibleVertices[k]].x + 20, points[visibleVertices[k]].y + 20, 10, BLACK);
+
+    EndMode2D();
+    //----------------------------------------------------------------------------------
+
+    profilerBegin(profiler, PROFILE_GUI);
+
+    // Draw Hovered Edge Weight beside the Cursor
+    if (hoveredEdge[0] != -1 && hoveredEdge[0] < pointCount && hoveredEdge[1] < pointCount && !hidden[hoveredEdge[0]] && !hidden[hoveredEdge[1]])
     {
-        DrawCircleV(points[i], (*focusedPoint == i)? 30.0f : 24.0f, (*focusedPoint == i)? GRAY: LIGHTGRAY);
-        DrawText(TextFormat("%s", (*theGraph).labels[i]), points[i].x - 5, points[i].y - 5, 15, BLACK);
+        Vector2 mousePos = GetMousePosition();
+        DrawText(TextFormat("%s -> %s: %d", theGraph->labels[hoveredEdge[0]], theGraph->labels[hoveredEdge[1]], theGraph->adj[hoveredEdge[0]][hoveredEdge[1]]),
+            mousePos.x + 15, mousePos.y - 15, 12, BLACK);
     }
 
     // Draw Configs
+    if (*spanningTreeActive)
+        GuiLabel((Rectangle){218, 84, 250, 24}, TextFormat("Tree Weight: %lld (%d Trees)", spanningForest->totalWeight, spanningForest->treeCount));
     if (GuiButton((Rectangle){12, 12, 24, 24}, "#185#"))
         *currentScene = START_MENU;
     if (GuiButton((Rectangle){48, 12, 24, 24}, "#75#"))
         createPointPolygon(points, pointCount, (Vector2){halfScreenWidth, halfScreenHeight}, polygonRadius);
-    if (GuiButton((Rectangle){84, 12, 128, 24}, "Randomize") && !(*(bfsData->animationActive)) && !(*(dfsData->animationActive)) && !(*(dijkstraData->animationActive)))
+    if (GuiButton((Rectangle){84, 12, 128, 24}, "Randomize"))
         changeWeights(theGraph);
     if (GuiButton((Rectangle){12, 48, 200, 24}, "Show Adjacency Matrix"))
         *adjacencyMatrixWindowActive = !(*adjacencyMatrixWindowActive);
+    if (GuiButton((Rectangle){12, 84, 200, 24}, (*spanningTreeActive) ? "Hide Spanning Tree" : "Show Spanning Tree"))
+        *spanningTreeActive = !(*spanningTreeActive);
+    if (GuiButton((Rectangle){12, 120, 200, 24}, (*pageRankActive) ? "Hide PageRank" : "Show PageRank"))
+    {
+        *pageRankActive = !(*pageRankActive);
+        *communitiesActive = false;
+    }
+    GuiLabel((Rectangle){12, 156, 200, 24}, TextFormat("Minimum Core: %i of %i", (int)(*minimumCore), coreResult->maxCore));
+    GuiSliderBar((Rectangle){12, 180, 200, 24}, NULL, NULL, minimumCore, 0.0f, (float)coreResult->maxCore + 0.99f);
+    if (GuiButton((Rectangle){12, 216, 200, 24}, (*communitiesActive) ? "Hide Communities" : "Show Communities"))
+    {
+        *communitiesActive = !(*communitiesActive);
+        *pageRankActive = false;
+    }
+    if (*communitiesActive)
+        GuiLabel((Rectangle){218, 216, 250, 24}, TextFormat("%i Communities, Q = %.3f", communityResult->count, communityResult->modularity));
+    if (GuiButton((Rectangle){12, 252, 200, 24}, (*pathIndex != -1) ? "Hide Shortest Paths" : "Show Shortest Paths"))
+    {
+        *pathIndex = (*pathIndex != -1) ? -1 : 0;
+        pathSet->version = 0;
+    }
+    if (*pathIndex != -1)
+    {
+        if (GuiButton((Rectangle){218, 252, 24, 24}, "#114#") && pathSet->count > 0)
+            *pathIndex = (*pathIndex + pathSet->count - 1) % pathSet->count;
+        if (GuiButton((Rectangle){248, 252, 24, 24}, "#115#") && pathSet->count > 0)
+            *pathIndex = (*pathIndex + 1) % pathSet->count;
+        if (*pathIndex < pathSet->count)
+            GuiLabel((Rectangle){278, 252, 250, 24}, TextFormat("Path %i of %i, Length: %d", *pathIndex + 1, pathSet->count, pathSet->length[*pathIndex]));
+        else
+            GuiLabel((Rectangle){278, 252, 250, 24}, "No Path Found");
+    }
+    if (GuiButton((Rectangle){12, 288, 200, 24}, (*minimumCutActive) ? "Hide Minimum Cut" : "Show Minimum Cut"))
+        *minimumCutActive = !(*minimumCutActive);
+    if (*minimumCutActive)
+        GuiLabel((Rectangle){218, 288, 250, 24}, (flowResult->n > 0) ? TextFormat("Max Flow: %lld (%d Cut Edges)", flowResult->value, flowResult->cutEdges) : "No Source or Sink");
+    GuiLabel((Rectangle){12, 420, 250, 24}, TextFormat("Neighbourhood: %i Hops (N to Open)", (int)(*neighbourhoodHops)));
+    GuiSliderBar((Rectangle){12, 444, 200, 24}, NULL, NULL, neighbourhoodHops, 1.0f, 6.99f);
+    if (
+        GuiButton((Rectangle){12, 480, 200, 24}, "Reorder Vertices (RCM)") &&
+        !(*(bfsData->animationActive)) && !(*(dfsData->animationActive)) && !(*(dijkstraData->animationActive))
+    )
+    {
+        // Points travel with their Vertices so the Drawing does not change
+        Permutation perm;
+        Graph reordered;
+        Vector2 moved[MAX_VERTICES];
+        reorderPermutation(theGraph, REORDER_RCM, &perm);
+        if (permuteGraph(theGraph, &perm, &reordered) == 0)
+        {
+            for (int i = 0; i < pointCount; i++)
+                moved[i] = points[perm.oldIndex[i]];
+            for (int i = 0; i < pointCount; i++)
+                points[i] = moved[i];
+            graphDeinit(theGraph);
+            *theGraph = reordered;
+            *focusedPoint = -1;
+        }
+    }
+    if (GuiButton((Rectangle){12, 516, 200, 24}, (*layoutActive) ? "Stop Force Layout" : "Run Force Layout"))
+        *layoutActive = !(*layoutActive);
+    if (*layoutActive)
+        GuiLabel((Rectangle){218, 516, 250, 24}, TextFormat("Iteration %i, Step %.1f", layoutIterations, layoutTemperature));
 
     // Draw Algorithm Source Labels
     GuiTextBox((Rectangle){12, bfsOffset, 60, 24}, bfsData->srcLabel, 4096, 
@@ -431,7 +1145,7 @@ void mainScene(Vector2 *points, Graph *theGraph, int pointCount, int *focusedPoi
     }
 
     // Draw Algorithm Results
-    if (*(bfsData->animationActive) && !(*(dfsData->animationActive)) && !(*(dijkstraData->animationActive)) && *(bfsData->status) == IN_PROGRESS)
+    if (bfsShown)
     {
         // Draw Title
         DrawText("Breadth-First Search", bfsTitleOffset, 12, 18, BLACK);
@@ -453,39 +1167,19 @@ void mainScene(Vector2 *points, Graph *theGraph, int pointCount, int *focusedPoi
 
             // Draw Queue Elements
             GuiTextBox((Rectangle){queueX + 24 * i, queueY, 24, 24},
-                ((*(bfsData->qRear)) - (*(bfsData->qFront)) > i) ? theGraph->labels[bfsData->queue[(*(bfsData->qFront)) + i]] : "",
+                (state->rear - state->front > i) ? theGraph->labels[state->items[state->front + i]] : "",
                 0, false
             );
 
             // Draw Visited Elements
             GuiLabel((Rectangle){visitedX, currY, 24, 24}, theGraph->labels[i]);
             GuiTextBox((Rectangle){visitedX + 24, currY, 24, 24},
-                (dfsData->visited[i]) ? "#112#" : "#113#",
+                (state->visited[i]) ? "#112#" : "#113#",
                 0, false
             );
-
-            // Draw Visited Vertices
-            if (bfsData->visited[i])
-                DrawRing(points[i], 24.0f, 26.0f, 0, 360, 90, BLACK);
         }
-
-        // Draw Queue Vertices
-        for (int i = *(bfsData->qFront); i < *(bfsData->qRear); i++)
-            DrawRing(points[bfsData->queue[i]], 24.0f, 26.0f, 0, 360, 90, YELLOW);
-
-        // Draw Children Vertices
-        for (int i = 0; i < *(bfsData->childrenTop); i++)
-            DrawRing(points[bfsData->children[i]], 24.0f, 26.0f, 0, 360, 90, BLUE);
-
-        // Draw Current, Source and Destination Vertices
-        if (*(bfsData->current) != -1)
-            DrawRing(points[*(bfsData->current)], 24.0f, 26.0f, 0, 360, 90, ORANGE);
-        if (*(bfsData->src) != -1)
-            DrawRing(points[*(bfsData->src)], 24.0f, 26.0f, 0, 360, 90, RED);
-        if (*(bfsData->dest) != -1)
-            DrawRing(points[*(bfsData->dest)], 24.0f, 26.0f, 0, 360, 90, GREEN);
     }
-    else if (!(*(bfsData->animationActive)) && *(dfsData->animationActive) && !(*(dijkstraData->animationActive)) && *(dfsData->status) == IN_PROGRESS)
+    else if (dfsShown)
     {
         // Draw Title
         DrawText("Depth-First Search", dfsTitleOffset, 12, 18, BLACK);
@@ -506,39 +1200,19 @@ void mainScene(Vector2 *points, Graph *theGraph, int pointCount, int *focusedPoi
 
             // Draw Stack Elements
             GuiTextBox((Rectangle){stackX, currY, 24, 24},
-                (*(dfsData->sTop) > pointCount - i - 1) ? theGraph->labels[dfsData->stack[pointCount - i - 1]] : "",
+                (state->rear > pointCount - i - 1) ? theGraph->labels[state->items[pointCount - i - 1]] : "",
                 0, false
             );
 
             // Draw Visited Elements
             GuiLabel((Rectangle){visitedX, currY, 24, 24}, theGraph->labels[i]);
             GuiTextBox((Rectangle){visitedX + 24, currY, 24, 24},
-                (dfsData->visited[i]) ? "#112#" : "#113#",
+                (state->visited[i]) ? "#112#" : "#113#",
                 0, false
             );
-
-            // Draw Visited Vertices
-            if (dfsData->visited[i])
-                DrawRing(points[i], 24.0f, 26.0f, 0, 360, 90, BLACK);
         }
-
-        // Draw Stack Vertices
-        for (int i = 0; i < *(dfsData->sTop); i++)
-            DrawRing(points[dfsData->stack[i]], 24.0f, 26.0f, 0, 360, 90, YELLOW);
-
-        // Draw Children Vertices
-        for (int i = 0; i < *(dfsData->childrenTop); i++)
-            DrawRing(points[dfsData->children[i]], 24.0f, 26.0f, 0, 360, 90, BLUE);
-
-        // Draw Current, Source and Destination Vertices
-        if (*(dfsData->current) != -1)
-            DrawRing(points[*(dfsData->current)], 24.0f, 26.0f, 0, 360, 90, ORANGE);
-        if (*(dfsData->src) != -1)
-            DrawRing(points[*(dfsData->src)], 24.0f, 26.0f, 0, 360, 90, RED);
-        if (*(dfsData->dest) != -1)
-            DrawRing(points[*(dfsData->dest)], 24.0f, 26.0f, 0, 360, 90, GREEN);
     }
-    else if (!(*(bfsData->animationActive)) && !(*(dfsData->animationActive)) && *(dijkstraData->animationActive) && *(dijkstraData->status) == IN_PROGRESS)
+    else if (dijkstraShown)
     {
         // Draw Title
         DrawText("Dijkstra's Algorithm", dijkstraTitleOffset, 12, 18, BLACK);
@@ -561,93 +1235,35 @@ void mainScene(Vector2 *points, Graph *theGraph, int pointCount, int *focusedPoi
             // Draw Parent Elements
             GuiLabel((Rectangle){labelX, currY, 24, 24}, theGraph->labels[i]);
             GuiTextBox((Rectangle){parentX, currY, 24, 24},
-                dijkstraData->previous[i] == -1 ? "" : theGraph->labels[dijkstraData->previous[i]],
+                state->previous[i] == -1 ? "" : theGraph->labels[state->previous[i]],
                 0, false
             );
 
             // Draw Distance Elements
             GuiTextBox((Rectangle){distanceX + 24, currY, 24, 24},
-                (dijkstraData->distance[i] != INT_MAX && dijkstraData->distance[i] != INT_MIN) ? (char*)TextFormat("%d", dijkstraData->distance[i]) : "#219#",
+                (state->distance[i] != INT_MAX && state->distance[i] != INT_MIN) ? (char*)TextFormat("%d", state->distance[i]) : "#219#",
                 0, false
             );
-
-            // Draw Vertex Distances
-            if (dijkstraData->distance[i] != INT_MAX && dijkstraData->distance[i] != INT_MIN)
-            {
-                DrawText(TextFormat("%d", dijkstraData->distance[i]), points[i].x + 24, points[i].y + 24, 12, BLACK);
-
-                // Draw Vertex's Parent // TODO: Refactor this to reduce Redundancy
-                if (dijkstraData->previous[i] != -1)
-                {
-                    DrawLineEx(points[dijkstraData->previous[i]], points[i], *edgeThickness, GRAY);
-                    drawArrow(points[dijkstraData->previous[i]], points[i], GRAY);
-                    DrawCircleV(points[i], (*focusedPoint == i)? 30.0f : 24.0f, (*focusedPoint == i)? GRAY: LIGHTGRAY);
-                    DrawText(TextFormat("%s", (*theGraph).labels[i]), points[i].x - 5, points[i].y - 5, 15, BLACK);
-                    DrawCircleV(points[dijkstraData->previous[i]], (*focusedPoint == dijkstraData->previous[i])? 30.0f : 24.0f, (*focusedPoint == dijkstraData->previous[i])? GRAY: LIGHTGRAY);
-                    DrawText(TextFormat("%s", (*theGraph).labels[dijkstraData->previous[i]]), points[dijkstraData->previous[i]].x - 5, points[dijkstraData->previous[i]].y - 5, 15, BLACK);
-                }
-            }
         }
 
-        // Draw Children Vertices
-        for (int i = 0; i < *(dijkstraData->childrenTop); i++)
-            DrawRing(points[dijkstraData->children[i]], 24.0f, 26.0f, 0, 360, 90, BLUE);
-
-        // Draw Current, Source and Destination Vertices
-        if (*(dijkstraData->current) != -1)
-            DrawRing(points[*(dijkstraData->current)], 24.0f, 26.0f, 0, 360, 90, ORANGE);
-        if (*(dijkstraData->src) != -1)
-            DrawRing(points[*(dijkstraData->src)], 24.0f, 26.0f, 0, 360, 90, RED);
-        if (*(dijkstraData->dest) != -1)
-            DrawRing(points[*(dijkstraData->dest)], 24.0f, 26.0f, 0, 360, 90, GREEN);
-
-        // Draw Path // TODO: Refactor this to reduce Redundancy
-        if (*(dijkstraData->pathHead) != MAX_VERTICES && dijkstraData->path[*(dijkstraData->pathHead)] == *(dijkstraData->src))
-        {
-            int parent, child, pathLength = 0;
-            for (int i = *(dijkstraData->pathHead); i < MAX_VERTICES - 1; i++)
-            {
-                parent = dijkstraData->path[i];
-                child = dijkstraData->path[i + 1];
-                pathLength += (*theGraph).adj[parent][child];
-                DrawLineEx(points[parent], points[child], *edgeThickness, BLACK);
-                drawArrow(points[parent], points[child], BLACK);
-                DrawCircleV(points[parent], (*focusedPoint == parent)? 30.0f : 24.0f, (*focusedPoint == parent)? GRAY: LIGHTGRAY);
-                DrawText(TextFormat("%s", (*theGraph).labels[parent]), points[parent].x - 5, points[parent].y - 5, 15, BLACK);
-            }
-            DrawCircleV(points[child], (*focusedPoint == child)? 30.0f : 24.0f, (*focusedPoint == child)? GRAY: LIGHTGRAY);
-            DrawText(TextFormat("%s", (*theGraph).labels[child]), points[child].x - 5, points[child].y - 5, 15, BLACK);
-            GuiLabel((Rectangle){parentX, dsY + 24 * (pointCount + 2), 120, 24}, TextFormat("Path Length: %d", pathLength));
-        }
+        // Draw Path Length
+        if (dijkstraPathLength != -1)
+            GuiLabel((Rectangle){parentX, dsY + 24 * (pointCount + 2), 120, 24}, TextFormat("Path Length: %d", dijkstraPathLength));
         else
             GuiLabel((Rectangle){parentX, dsY + 24 * (pointCount + 2), 150, 24}, "No Path Found");
     }
 
-    // Draw Adjacency Matrix Window
+    // Draw Adjacency Matrix Window, ringing the Vertices of the Cell under the Cursor
     if (*adjacencyMatrixWindowActive)
     {
-        int windowSize = 48 * (pointCount < 4 ? 6 : pointCount + 2);
-        int windowX = screenWidth - windowSize - 12;
-        int windowY = 12;
-        *adjacencyMatrixWindowActive = !GuiWindowBox((Rectangle){windowX, windowY, windowSize - 16, windowSize}, "Adjacency Matrix");
-        for (int i = 0; i < pointCount; i++)
+        int row, column;
+        *adjacencyMatrixWindowActive = matrixViewDraw(matrixView, theGraph, screenWidth, true, &row, &column);
+        if (row != -1 && row < pointCount && column < pointCount)
         {
-            for (int j = 0; j < pointCount; j++)
-            {
-                if (
-                    CheckCollisionPointRec(GetMousePosition(), (Rectangle){windowX + 40 + 50 * j, 72 + 50 * i, 40, 40}) &&
-                    !(*(bfsData->animationActive)) && !(*(dfsData->animationActive)) && !(*(dijkstraData->animationActive))
-                )
-                {
-                    GuiValueBox((Rectangle){windowX + 40 + 50 * j, 72 + 50 * i, 40, 40}, "", &(*theGraph).adj[i][j], 0, INT_MAX, true);
-                    DrawRing(points[i], 24.0f, 26.0f, 0, 360, 90, RED);
-                    DrawRing(points[j], 24.0f, 26.0f, 0, 360, 90, LIME);
-                }
-                else
-                    GuiValueBox((Rectangle){windowX + 40 + 50 * j, 72 + 50 * i, 40, 40}, "", &(*theGraph).adj[i][j], 0, INT_MAX, false);
-            }
-            GuiLabel((Rectangle){windowX + 16, 72 + 50 * i, 40, 40}, (*theGraph).labels[i]);
-            GuiLabel((Rectangle){windowX + 56 + 50 * i, 36, 40, 40}, (*theGraph).labels[i]);
+            BeginMode2D(*camera);
+            DrawRing(points[row], 24.0f, 26.0f, 0, 360, 90, RED);
+            DrawRing(points[column], 24.0f, 26.0f, 0, 360, 90, LIME);
+            EndMode2D();
         }
     }
 
@@ -657,9 +1273,19 @@ void mainScene(Vector2 *points, Graph *theGraph, int pointCount, int *focusedPoi
         GuiLabel((Rectangle){ 12, screenHeight - 60, 160, 24 }, TextFormat("Edge Thickness: %i", (int)*edgeThickness));
         GuiSliderBar((Rectangle){ 12, screenHeight - 36, 160, 24 }, NULL, NULL, edgeThickness, 1.0f, 40.0f);
         GuiLabel((Rectangle){ screenWidth - 150, screenHeight - 36, 150, 24 }, TextFormat("Focused Point: %i", (int)*focusedPoint));
-
-        for (int i = 0; i < pointCount; i++)
-            DrawText(TextFormat("(%.2f, %.2f)", points[i].x, points[i].y), points[i].x + 20, points[i].y + 20, 10, BLACK);
+        if (*pageRankActive)
+            GuiLabel((Rectangle){ 12, screenHeight - 84, 300, 24 }, TextFormat("PageRank: %i Iterations in %.3f ms", pageRankResult->iterations, pageRankResult->totalSeconds * 1000.0));
+
+        if (eccentricity->version != theGraph->version)
+            graphDiameter(theGraph, parallelThreadCount(), eccentricity);
+        GuiLabel((Rectangle){ 12, screenHeight - 180, 400, 24 }, TextFormat("Static Layer: %i Redraws", staticLayer->redraws));
+        if (*adjacencyMatrixWindowActive)
+            GuiLabel((Rectangle){ 12, screenHeight - 204, 400, 24 }, TextFormat("Adjacency Matrix: %i Cells drawn, %i Heatmap Uploads", matrixView->cellsDrawn, matrixView->uploads));
+        GuiLabel((Rectangle){ 12, screenHeight - 156, 500, 24 }, TextFormat("View: %i of %i Vertices, %i Edges drawn, %i merged Cells, Zoom %.2f", visibleVertexCount, pointCount, edgeMesh->drawnEdges, edgeMesh->mergedCells, camera->zoom));
+        GuiLabel((Rectangle){ 12, screenHeight - 132, 400, 24 }, TextFormat("Edge Mesh: %i Triangles, %i Rebuilds", edgeMesh->triangleCount, edgeMesh->rebuilds));
+        GuiLabel((Rectangle){ 12, screenHeight - 108, 400, 24 }, TextFormat("Diameter: %i, Radius: %i (%i BFS Runs of %i)", eccentricity->diameter, eccentricity->radius, eccentricity->bfsRuns, eccentricity->n));
     }
+
+    profilerEnd(profiler, PROFILE_GUI);
 }
 //----------------------------------------------------------------------------------
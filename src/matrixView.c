@@ -0,0 +1,153 @@
+#include "matrixView.h"
+
+#include <limits.h>
+#include <math.h>
+
+#include "raygui.h"
+
+// Cells along one Axis overlapping a Window onto the Content, Cell i spanning [pitch * (i + 1), pitch * (i + 2))
+// since the first Row and Column hold the Labels; first > last if none do
+static void _visibleRange(float scroll, float length, int count, int *first, int *last)
+{
+    *first = (int)floorf(-scroll / MATRIX_VIEW_PITCH) - 1;
+    *last = (int)floorf((-scroll + length) / MATRIX_VIEW_PITCH) - 1;
+    if (*first < 0)
+        *first = 0;
+    if (*last > count - 1)
+        *last = count - 1;
+}
+
+// Upload the Weights as a Texture of one Pixel per Cell, darker for heavier Edges
+static void _uploadHeatmap(MatrixView *view, Graph *g)
+{
+    int maxWeight = 1;
+    for (int i = 0; i < g->n; i++)
+        for (int j = 0; j < g->n; j++)
+            if (g->adj[i][j] > maxWeight)
+                maxWeight = g->adj[i][j];
+
+    Image image = GenImageColor(g->n, g->n, RAYWHITE);
+    Color *pixels = (Color *)image.data;
+    for (int i = 0; i < g->n; i++)
+        for (int j = 0; j < g->n; j++)
+            if (g->adj[i][j] > 0)
+            {
+                float t = (float)g->adj[i][j] / maxWeight;
+                pixels[i * g->n + j] = ColorFromHSV(210.0f, 0.25f + 0.75f * t, 0.95f - 0.5f * t);
+            }
+
+    // Reuse the Texture while the Size stays the same
+    if (view->textureLoaded && view->texture.width == g->n)
+        UpdateTexture(view->texture, pixels);
+    else
+    {
+        if (view->textureLoaded)
+            UnloadTexture(view->texture);
+        view->texture = LoadTextureFromImage(image);
+        SetTextureFilter(view->texture, TEXTURE_FILTER_POINT);
+        view->textureLoaded = true;
+    }
+    UnloadImage(image);
+    view->version = g->version;
+    view->uploads++;
+}
+
+// Initialize a Matrix View showing the Cells from the Top Left
+void matrixViewInit(MatrixView *view)
+{
+    view->bounds = (Rectangle){0, 0, 0, 0};
+    view->scroll = (Vector2){0, 0};
+    view->heatmap = false;
+    view->version = 0;
+    view->textureLoaded = false;
+    view->uploads = 0;
+    view->cellsDrawn = 0;
+}
+
+// Free the Heatmap, must happen before the Window is closed
+void matrixViewDeinit(MatrixView *view)
+{
+    if (view->textureLoaded)
+        UnloadTexture(view->texture);
+    view->textureLoaded = false;
+    view->version = 0;
+}
+
+// Draw the Window in the Top Right Corner, returns false once it is closed
+// The Cell under the Cursor is given as its Row and Column (-1 if none), and edited when editable
+bool matrixViewDraw(MatrixView *view, Graph *g, int screenWidth, bool editable, int *hoveredRow, int *hoveredColumn)
+{
+    int n = g->n;
+    float size = fminf(48.0f * (n < 4 ? 6 : n + 2), MATRIX_VIEW_MAX_SIZE);
+    Vector2 mouse = GetMousePosition();
+
+    *hoveredRow = *hoveredColumn = -1;
+    view->cellsDrawn = 0;
+    view->bounds = (Rectangle){screenWidth - size - 12, 12, size - 16, size};
+    if (GuiWindowBox(view->bounds, "Adjacency Matrix"))
+        return false;
+    if (GuiButton((Rectangle){view->bounds.x + 8, view->bounds.y + 30, 120, 24}, view->heatmap ? "Show Cells" : "Show Heatmap"))
+        view->heatmap = !view->heatmap;
+
+    Rectangle area = {view->bounds.x + 4, view->bounds.y + 60, view->bounds.width - 8, view->bounds.height - 64};
+    if (view->heatmap)
+    {
+        if (n == 0)
+            return true;
+        if (view->version != g->version || !view->textureLoaded)
+            _uploadHeatmap(view, g);
+
+        // Stretch the Texture over the Area, a Cell per Block of Pixels
+        float cell = fminf(area.width, area.height) / n;
+        DrawTexturePro(view->texture, (Rectangle){0, 0, (float)n, (float)n}, (Rectangle){area.x, area.y, cell * n, cell * n}, (Vector2){0, 0}, 0.0f, WHITE);
+        if (CheckCollisionPointRec(mouse, (Rectangle){area.x, area.y, cell * n, cell * n}))
+        {
+            *hoveredRow = (int)((mouse.y - area.y) / cell);
+            *hoveredColumn = (int)((mouse.x - area.x) / cell);
+            if (*hoveredRow >= n || *hoveredColumn >= n)
+                *hoveredRow = *hoveredColumn = -1;
+            else
+                DrawText(TextFormat("%s -> %s: %d", g->labels[*hoveredRow], g->labels[*hoveredColumn], g->adj[*hoveredRow][*hoveredColumn]),
+                    mouse.x + 15, mouse.y - 15, 12, BLACK);
+        }
+        return true;
+    }
+
+    // Labels sit in the first Row and Column of the Content and scroll with the Cells
+    Rectangle content = {0, 0, (float)MATRIX_VIEW_PITCH * (n + 1), (float)MATRIX_VIEW_PITCH * (n + 1)};
+    Rectangle visible = {0, 0, 0, 0};
+    GuiScrollPanel(area, NULL, content, &view->scroll, &visible);
+
+    int firstRow, lastRow, firstColumn, lastColumn;
+    _visibleRange(view->scroll.y, visible.height, n, &firstRow, &lastRow);
+    _visibleRange(view->scroll.x, visible.width, n, &firstColumn, &lastColumn);
+    float originX = visible.x + view->scroll.x, originY = visible.y + view->scroll.y;
+    bool mouseInside = CheckCollisionPointRec(mouse, visible);
+
+    BeginScissorMode((int)visible.x, (int)visible.y, (int)visible.width, (int)visible.height);
+    for (int i = firstRow; i <= lastRow; i++)
+    {
+        float y = originY + MATRIX_VIEW_PITCH * (i + 1);
+        GuiLabel((Rectangle){originX + 16, y, MATRIX_VIEW_CELL, MATRIX_VIEW_CELL}, g->labels[i]);
+        for (int j = firstColumn; j <= lastColumn; j++)
+        {
+            Rectangle cell = {originX + MATRIX_VIEW_PITCH * (j + 1), y, MATRIX_VIEW_CELL, MATRIX_VIEW_CELL};
+            bool hovered = mouseInside && CheckCollisionPointRec(mouse, cell);
+            if (hovered)
+            {
+                *hoveredRow = i;
+                *hoveredColumn = j;
+            }
+
+            int oldWeight = g->adj[i][j];
+            GuiValueBox(cell, "", &g->adj[i][j], 0, INT_MAX, hovered && editable);
+            if (g->adj[i][j] != oldWeight)
+                graphTouch(g);
+            view->cellsDrawn++;
+        }
+    }
+    for (int j = firstColumn; j <= lastColumn; j++)
+        GuiLabel((Rectangle){originX + MATRIX_VIEW_PITCH * (j + 1) + 16, originY + 4, MATRIX_VIEW_CELL, MATRIX_VIEW_CELL}, g->labels[j]);
+    EndScissorMode();
+    return true;
+}
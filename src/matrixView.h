@@ -0,0 +1,31 @@
+#ifndef _MATRIX_VIEW_H_
+#define _MATRIX_VIEW_H_
+
+#include <stdbool.h>
+
+#include "raylib.h"
+
+#include "graph.h"
+
+#define MATRIX_VIEW_PITCH 50
+#define MATRIX_VIEW_CELL 40
+#define MATRIX_VIEW_MAX_SIZE 560
+
+// Scrollable Adjacency Matrix Window, creating Value Boxes only for the Cells in View
+// Zoomed out, the whole Matrix is drawn as a Heatmap Texture uploaded once per Graph Version
+typedef struct matrixView_t {
+    Rectangle bounds;                     // Window Bounds in the last Frame
+    Vector2 scroll;                       // Scroll Offset of the Cells
+    bool heatmap;                         // Whether the Heatmap is shown instead of the Cells
+    unsigned int version;                 // Graph Version the Heatmap was uploaded for (0 if never uploaded)
+    Texture2D texture;                    // Heatmap, one Pixel per Cell
+    bool textureLoaded;                   // Whether the Texture holds anything
+    int uploads;                          // Times the Heatmap was uploaded
+    int cellsDrawn;                       // Value Boxes created in the last Frame
+} MatrixView;
+
+void matrixViewInit(MatrixView *view);
+void matrixViewDeinit(MatrixView *view);
+bool matrixViewDraw(MatrixView *view, Graph *g, int screenWidth, bool editable, int *hoveredRow, int *hoveredColumn);
+
+#endif
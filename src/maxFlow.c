@@ -0,0 +1,327 @@
+#include "maxFlow.h"
+
+#include <stdlib.h>
+
+#include "parallel.h"
+
+// Working State of a Push-Relabel Run
+typedef struct flowState_t {
+    Graph *g;                                      // Graph
+    int n;                                         // Number of Vertices
+    int src;                                       // Source Vertex
+    int sink;                                      // Sink Vertex
+    long long net[MAX_VERTICES][MAX_VERTICES];     // Net Flow from u to v, net[u][v] = -net[v][u]
+    long long excess[MAX_VERTICES];                // Excess of each Vertex
+    long long incoming[MAX_VERTICES];              // Excess pushed into each Vertex during a parallel Round
+    int height[MAX_VERTICES];                      // Height of each Vertex
+    int newHeight[MAX_VERTICES];                   // Height of each Vertex after a parallel Round
+    int count[2 * MAX_VERTICES + 1];               // Number of Vertices at each Height
+    int active[MAX_VERTICES];                      // Active Vertices of a parallel Round
+    int relabels;                                  // Relabels since the last Global Relabel
+    FlowResult *result;                            // Result
+} flowState;
+
+// Residual Capacity from u to v
+static inline long long _residual(flowState *s, int u, int v)
+{
+    return (long long)(s->g->adj[u][v] > 0 ? s->g->adj[u][v] : 0) - s->net[u][v];
+}
+
+// Push an Amount of Flow from u to v
+static inline void _push(flowState *s, int u, int v, long long amount)
+{
+    s->net[u][v] += amount;
+    s->net[v][u] -= amount;
+}
+
+// Set Heights to exact Residual Distances to the Sink, or n plus the Distance to the Source for Vertices cut off from it
+static void _globalRelabel(flowState *s)
+{
+    int n = s->n, queue[MAX_VERTICES];
+
+    for (int v = 0; v < n; v++)
+        s->height[v] = 2 * n - 1;
+    for (int h = 0; h <= 2 * n; h++)
+        s->count[h] = 0;
+
+    int roots[2] = {s->sink, s->src};
+    for (int r = 0; r < 2; r++)
+    {
+        int head = 0, tail = 0;
+        s->height[roots[r]] = (r == 0) ? 0 : n;
+        queue[tail++] = roots[r];
+        while (head < tail) {
+            int v = queue[head++];
+            for (int u = 0; u < n; u++)
+                if (s->height[u] == 2 * n - 1 && u != s->src && u != s->sink && _residual(s, u, v) > 0)
+                {
+                    s->height[u] = s->height[v] + 1;
+                    queue[tail++] = u;
+                }
+        }
+    }
+
+    for (int v = 0; v < n; v++)
+        s->count[s->height[v]]++;
+    s->relabels = 0;
+    s->result->globalRelabels++;
+}
+
+// Lowest Height among the Residual Neighbours of u
+static int _lowestNeighbour(flowState *s, int u)
+{
+    int lowest = 2 * s->n - 2;
+    for (int v = 0; v < s->n; v++)
+        if (s->height[v] < lowest && _residual(s, u, v) > 0)
+            lowest = s->height[v];
+    return lowest;
+}
+
+// Move u to a new Height
+static void _relabel(flowState *s, int u, int height)
+{
+    s->count[s->height[u]]--;
+    s->height[u] = height;
+    s->count[height]++;
+    s->relabels++;
+    s->result->relabels++;
+}
+
+// Lift every Vertex above an empty Height below n out of reach of the Sink
+static void _gap(flowState *s, int empty)
+{
+    bool lifted = false;
+    for (int v = 0; v < s->n; v++)
+        if (s->height[v] > empty && s->height[v] < s->n)
+        {
+            s->count[s->height[v]]--;
+            s->height[v] = s->n + 1;
+            s->count[s->height[v]]++;
+            lifted = true;
+        }
+    if (lifted)
+        s->result->gaps++;
+}
+
+// Saturate every Edge leaving the Source
+static void _flowStart(flowState *s, Graph *g, int src, int sink, FlowResult *result)
+{
+    s->g = g;
+    s->n = g->n;
+    s->src = src;
+    s->sink = sink;
+    s->result = result;
+    result->relabels = 0;
+    result->globalRelabels = 0;
+    result->gaps = 0;
+
+    for (int u = 0; u < g->n; u++)
+    {
+        s->excess[u] = 0;
+        s->incoming[u] = 0;
+        for (int v = 0; v < g->n; v++)
+            s->net[u][v] = 0;
+    }
+
+    for (int v = 0; v < g->n; v++)
+        if (v != src && g->adj[src][v] > 0)
+        {
+            _push(s, src, v, g->adj[src][v]);
+            s->excess[v] += g->adj[src][v];
+            s->excess[src] -= g->adj[src][v];
+        }
+
+    _globalRelabel(s);
+}
+
+// Copy the Flow and the Minimum Cut into the Result
+static void _flowFinish(flowState *s, FlowResult *result)
+{
+    int n = s->n, queue[MAX_VERTICES], head = 0, tail = 0;
+
+    result->n = n;
+    result->src = s->src;
+    result->sink = s->sink;
+    result->value = s->excess[s->sink];
+    for (int u = 0; u < n; u++)
+    {
+        result->sourceSide[u] = false;
+        for (int v = 0; v < n; v++)
+            result->flow[u][v] = (s->g->adj[u][v] > 0 && s->net[u][v] > 0) ? s->net[u][v] : 0;
+    }
+
+    // The Source Side is everything the Source still reaches in the Residual Graph
+    result->sourceSide[s->src] = true;
+    queue[tail++] = s->src;
+    while (head < tail) {
+        int u = queue[head++];
+        for (int v = 0; v < n; v++)
+            if (!result->sourceSide[v] && _residual(s, u, v) > 0)
+            {
+                result->sourceSide[v] = true;
+                queue[tail++] = v;
+            }
+    }
+
+    result->cutEdges = 0;
+    for (int u = 0; u < n; u++)
+        for (int v = 0; v < n; v++)
+            if (result->sourceSide[u] && !result->sourceSide[v] && s->g->adj[u][v] > 0)
+                result->cutEdges++;
+    result->version = s->g->version;
+}
+
+// Initialize an empty Flow Result
+void flowResultInit(FlowResult *result)
+{
+    result->version = 0;
+    result->n = 0;
+    result->src = -1;
+    result->sink = -1;
+    result->value = 0;
+    result->cutEdges = 0;
+}
+
+// Maximum Flow from src to sink by FIFO Push-Relabel with Global Relabel and Gap Heuristics, returns the Flow Value
+long long maxFlow(Graph *g, int src, int sink, FlowResult *result)
+{
+    flowState *s = (flowState *)malloc(sizeof(flowState));
+    int n = g->n, queue[MAX_VERTICES], current[MAX_VERTICES], head = 0, size = 0;
+    bool queued[MAX_VERTICES];
+
+    _flowStart(s, g, src, sink, result);
+
+    for (int v = 0; v < n; v++)
+    {
+        current[v] = 0;
+        queued[v] = (v != src && v != sink && s->excess[v] > 0);
+        if (queued[v])
+            queue[(head + size++) % MAX_VERTICES] = v;
+    }
+
+    while (size > 0) {
+        int u = queue[head];
+        head = (head + 1) % MAX_VERTICES;
+        size--;
+        queued[u] = false;
+
+        // Discharge u, Vertices lifted to n or above send their Excess back towards the Source
+        while (s->excess[u] > 0) {
+            if (current[u] == n)
+            {
+                int old = s->height[u];
+                _relabel(s, u, _lowestNeighbour(s, u) + 1);
+                current[u] = 0;
+
+                if (s->count[old] == 0 && old < n)
+                    _gap(s, old);
+                if (s->relabels >= n)
+                {
+                    _globalRelabel(s);
+                    for (int v = 0; v < n; v++)
+                        current[v] = 0;
+                }
+                continue;
+            }
+
+            int v = current[u];
+            if (s->height[u] == s->height[v] + 1 && _residual(s, u, v) > 0)
+            {
+                long long amount = _residual(s, u, v);
+                if (s->excess[u] < amount)
+                    amount = s->excess[u];
+                _push(s, u, v, amount);
+                s->excess[u] -= amount;
+                s->excess[v] += amount;
+                if (!queued[v] && v != src && v != sink)
+                {
+                    queued[v] = true;
+                    queue[(head + size++) % MAX_VERTICES] = v;
+                }
+            }
+            else
+                current[u]++;
+        }
+    }
+
+    _flowFinish(s, result);
+    long long value = result->value;
+    free(s);
+    return value;
+}
+
+// Push the Excess of an active Vertex along Edges admissible under the Heights of the Round
+// Only the higher End of an admissible Edge touches it, so no two Tasks share an Edge
+static void _parallelPushTask(int index, int threadId, void *context)
+{
+    (void)threadId;
+    flowState *s = (flowState *)context;
+    int u = s->active[index];
+
+    for (int v = 0; v < s->n && s->excess[u] > 0; v++)
+        if (s->height[u] == s->height[v] + 1 && _residual(s, u, v) > 0)
+        {
+            long long amount = _residual(s, u, v);
+            if (s->excess[u] < amount)
+                amount = s->excess[u];
+            _push(s, u, v, amount);
+            s->excess[u] -= amount;
+            __atomic_fetch_add(&s->incoming[v], amount, __ATOMIC_RELAXED);
+        }
+}
+
+// Find the new Height of an active Vertex that could not push out all of its Excess
+static void _parallelRelabelTask(int index, int threadId, void *context)
+{
+    (void)threadId;
+    flowState *s = (flowState *)context;
+    int u = s->active[index];
+
+    s->newHeight[u] = (s->excess[u] > 0) ? _lowestNeighbour(s, u) + 1 : s->height[u];
+}
+
+// Maximum Flow from src to sink by synchronous Push-Relabel, returns the Flow Value
+// Every Round pushes from all active Vertices at once across threadCount Threads, then relabels them at once
+long long parallelMaxFlow(Graph *g, int src, int sink, int threadCount, FlowResult *result)
+{
+    flowState *s = (flowState *)malloc(sizeof(flowState));
+    int n = g->n;
+
+    _flowStart(s, g, src, sink, result);
+
+    while (1) {
+        int activeCount = 0;
+        for (int v = 0; v < n; v++)
+            if (v != src && v != sink && s->excess[v] > 0)
+                s->active[activeCount++] = v;
+        if (activeCount == 0)
+            break;
+
+        parallelFor(activeCount, threadCount, _parallelPushTask, s);
+        parallelFor(activeCount, threadCount, _parallelRelabelTask, s);
+
+        // Apply new Heights and the Excess pushed during the Round
+        for (int i = 0; i < activeCount; i++)
+            if (s->newHeight[s->active[i]] != s->height[s->active[i]])
+                _relabel(s, s->active[i], s->newHeight[s->active[i]]);
+        for (int v = 0; v < n; v++)
+        {
+            s->excess[v] += s->incoming[v];
+            s->incoming[v] = 0;
+        }
+
+        for (int h = 1; h < n; h++)
+            if (s->count[h] == 0)
+            {
+                _gap(s, h);
+                break;
+            }
+        if (s->relabels >= n)
+            _globalRelabel(s);
+    }
+
+    _flowFinish(s, result);
+    long long value = result->value;
+    free(s);
+    return value;
+}
@@ -0,0 +1,29 @@
+#ifndef _MAX_FLOW_H_
+#define _MAX_FLOW_H_
+
+#include <stdbool.h>
+
+#include "graph.h"
+
+#define FLOW_PARALLEL_MIN_VERTICES 32
+
+// Maximum Flow and Minimum Cut between two Vertices, Edge Weights taken as Capacities
+typedef struct flowResult_t {
+    unsigned int version;                        // Graph Version the Flow was computed for (0 if never computed)
+    int n;                                       // Number of Vertices
+    int src;                                     // Source Vertex
+    int sink;                                    // Sink Vertex
+    long long value;                             // Maximum Flow Value
+    long long flow[MAX_VERTICES][MAX_VERTICES];  // Flow along each Edge
+    bool sourceSide[MAX_VERTICES];               // Whether each Vertex is on the Source Side of the Minimum Cut
+    int cutEdges;                                // Number of Edges crossing the Minimum Cut
+    int relabels;                                // Relabel Operations performed
+    int globalRelabels;                          // Global Relabels performed
+    int gaps;                                    // Gaps found
+} FlowResult;
+
+void flowResultInit(FlowResult *result);
+long long maxFlow(Graph *g, int src, int sink, FlowResult *result);
+long long parallelMaxFlow(Graph *g, int src, int sink, int threadCount, FlowResult *result);
+
+#endif
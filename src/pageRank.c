@@ -0,0 +1,166 @@
+#include "pageRank.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parallel.h"
+
+#define PAGERANK_LANES 4
+#define PAGERANK_STRIDE (((MAX_VERTICES + PAGERANK_LANES - 1) / PAGERANK_LANES) * PAGERANK_LANES)
+#define PAGERANK_BLOCK_ROWS 8
+#define PAGERANK_BLOCKS ((MAX_VERTICES + PAGERANK_BLOCK_ROWS - 1) / PAGERANK_BLOCK_ROWS)
+
+// Four Floats processed together by one SIMD Instruction
+typedef float floatVector __attribute__((vector_size(PAGERANK_LANES * sizeof(float))));
+
+typedef struct pageRankShared_t {
+    float transition[MAX_VERTICES][PAGERANK_STRIDE] __attribute__((aligned(16))); // transition[v][u]: Probability of stepping from u to v
+    float rank[PAGERANK_STRIDE] __attribute__((aligned(16)));                     // Scores of the current Iteration, zero padded
+    float next[PAGERANK_STRIDE];                                                  // Scores of the next Iteration
+    float teleport[MAX_VERTICES];                                                 // Normalized Personalization Vector
+    float base[MAX_VERTICES];                                                     // Teleport and Dangling Mass landing on each Vertex
+    float residual[PAGERANK_BLOCKS];                                              // L1 Change per Block of Rows
+    int n;                                                                        // Number of Vertices
+    int width;                                                                    // Row Width rounded up to whole Vectors
+    float damping;                                                                // Damping Factor
+} pageRankShared;
+
+// Multiply a Block of Rows of the Transition Matrix with the current Scores
+static void _pageRankBlock(int block, int threadId, void *context)
+{
+    (void)threadId;
+    pageRankShared *shared = (pageRankShared *)context;
+
+    int end = (block + 1) * PAGERANK_BLOCK_ROWS;
+    if (end > shared->n)
+        end = shared->n;
+
+    float residual = 0.0f;
+    for (int v = block * PAGERANK_BLOCK_ROWS; v < end; v++)
+    {
+        const floatVector *row = (const floatVector *)shared->transition[v];
+        const floatVector *rank = (const floatVector *)shared->rank;
+        floatVector sum = {0};
+        for (int k = 0; k < shared->width / PAGERANK_LANES; k++)
+            sum += row[k] * rank[k];
+
+        float score = shared->base[v] + shared->damping * (sum[0] + sum[1] + sum[2] + sum[3]);
+        residual += (score > shared->rank[v]) ? score - shared->rank[v] : shared->rank[v] - score;
+        shared->next[v] = score;
+    }
+    shared->residual[block] = residual;
+}
+
+// Initialize an empty PageRank Result
+void pageRankInit(PageRankResult *result)
+{
+    result->version = 0;
+    result->n = 0;
+    result->maxRank = 0.0f;
+    result->iterations = 0;
+    result->converged = false;
+    result->totalSeconds = 0.0;
+}
+
+// PageRank with uniform Teleportation, returns the Iterations run
+int pageRank(Graph *g, float damping, float tolerance, int threadCount, PageRankResult *result)
+{
+    return personalizedPageRank(g, NULL, damping, tolerance, threadCount, result);
+}
+
+// PageRank teleporting according to personalization (uniform if NULL), returns the Iterations run
+// Rows of the Transition Matrix are split across threadCount Threads and multiplied with SIMD Vectors
+// Scores of Vertices without Out-Edges are redistributed like a Teleport
+int personalizedPageRank(Graph *g, float personalization[], float damping, float tolerance, int threadCount, PageRankResult *result)
+{
+    double start = parallelTime();
+    int n = g->n;
+
+    pageRankInit(result);
+    result->n = n;
+    if (n == 0)
+    {
+        result->version = g->version;
+        return 0;
+    }
+
+    pageRankShared *shared = (pageRankShared *)calloc(1, sizeof(pageRankShared));
+    shared->n = n;
+    shared->width = ((n + PAGERANK_LANES - 1) / PAGERANK_LANES) * PAGERANK_LANES;
+    shared->damping = damping;
+
+    // Normalize the Personalization Vector, falling back to uniform if it has no Mass
+    float mass = 0.0f;
+    for (int i = 0; i < n; i++)
+        mass += (personalization != NULL && personalization[i] > 0.0f) ? personalization[i] : 0.0f;
+    for (int i = 0; i < n; i++)
+    {
+        if (mass > 0.0f)
+            shared->teleport[i] = (personalization[i] > 0.0f) ? personalization[i] / mass : 0.0f;
+        else
+            shared->teleport[i] = 1.0f / n;
+        shared->rank[i] = 1.0f / n;
+    }
+
+    // Build the column-stochastic Transition Matrix
+    bool dangling[MAX_VERTICES];
+    for (int u = 0; u < n; u++)
+    {
+        int degree = 0;
+        for (int v = 0; v < n; v++)
+            if (g->adj[u][v])
+                degree++;
+
+        dangling[u] = (degree == 0);
+        for (int v = 0; v < n; v++)
+            if (g->adj[u][v])
+                shared->transition[v][u] = 1.0f / degree;
+    }
+
+    int blocks = (n + PAGERANK_BLOCK_ROWS - 1) / PAGERANK_BLOCK_ROWS;
+    while (result->iterations < PAGERANK_MAX_ITERATIONS && !result->converged) {
+        double iterationStart = parallelTime();
+
+        float danglingMass = 0.0f;
+        for (int u = 0; u < n; u++)
+            if (dangling[u])
+                danglingMass += shared->rank[u];
+        for (int v = 0; v < n; v++)
+            shared->base[v] = ((1.0f - damping) + damping * danglingMass) * shared->teleport[v];
+
+        parallelFor(blocks, threadCount, _pageRankBlock, shared);
+
+        float residual = 0.0f;
+        for (int b = 0; b < blocks; b++)
+            residual += shared->residual[b];
+        for (int v = 0; v < n; v++)
+            shared->rank[v] = shared->next[v];
+
+        result->residual[result->iterations] = residual;
+        result->seconds[result->iterations] = parallelTime() - iterationStart;
+        result->iterations++;
+        result->converged = (residual < tolerance);
+    }
+
+    for (int v = 0; v < n; v++)
+    {
+        result->rank[v] = shared->rank[v];
+        if (result->rank[v] > result->maxRank)
+            result->maxRank = result->rank[v];
+    }
+    free(shared);
+
+    result->totalSeconds = parallelTime() - start;
+    result->version = g->version;
+    return result->iterations;
+}
+
+// Print the Scores and the per-Iteration Timings
+void pageRankReport(Graph *g, PageRankResult *result)
+{
+    printf("PageRank: %d Iterations, %s, %.3f ms\n", result->iterations, result->converged ? "converged" : "not converged", result->totalSeconds * 1000.0);
+    for (int i = 0; i < result->iterations; i++)
+        printf("  Iteration %d: Residual %g, %.3f ms\n", i + 1, result->residual[i], result->seconds[i] * 1000.0);
+    for (int i = 0; i < result->n && i < g->n; i++)
+        printf("%s: %f\n", g->labels[i], result->rank[i]);
+}
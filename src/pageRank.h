@@ -0,0 +1,31 @@
+#ifndef _PAGE_RANK_H_
+#define _PAGE_RANK_H_
+
+#include <stdbool.h>
+
+#include "graph.h"
+
+#define PAGERANK_MAX_ITERATIONS 100
+#define PAGERANK_DAMPING 0.85f
+#define PAGERANK_TOLERANCE 1e-6f
+#define PAGERANK_PARALLEL_MIN_VERTICES 32
+
+// PageRank Scores with a per-Iteration Report
+typedef struct pageRankResult_t {
+    unsigned int version;                    // Graph Version the Scores were computed for (0 if never computed)
+    int n;                                   // Number of Vertices
+    float rank[MAX_VERTICES];                // Score of each Vertex, summing to 1
+    float maxRank;                           // Highest Score
+    int iterations;                          // Iterations run
+    bool converged;                          // Whether the Tolerance was reached
+    float residual[PAGERANK_MAX_ITERATIONS]; // L1 Change of the Scores in each Iteration
+    double seconds[PAGERANK_MAX_ITERATIONS]; // Wall Time of each Iteration
+    double totalSeconds;                     // Wall Time of the whole Run
+} PageRankResult;
+
+void pageRankInit(PageRankResult *result);
+int pageRank(Graph *g, float damping, float tolerance, int threadCount, PageRankResult *result);
+int personalizedPageRank(Graph *g, float personalization[], float damping, float tolerance, int threadCount, PageRankResult *result);
+void pageRankReport(Graph *g, PageRankResult *result);
+
+#endif
@@ -0,0 +1,85 @@
+#include "parallel.h"
+
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef struct parallelForShared_t {
+    int count;           // Number of Indices
+    int next;            // Next Unclaimed Index
+    parallelTask task;   // Task to Run
+    void *context;       // Shared Context
+} parallelForShared;
+
+typedef struct parallelForWorker_t {
+    parallelForShared *shared; // Shared Loop State
+    int threadId;              // Worker Thread ID
+} parallelForWorker;
+
+// Claim and run Indices until the Loop is exhausted
+static void *_parallelForRun(void *arg)
+{
+    parallelForWorker *worker = (parallelForWorker *)arg;
+    parallelForShared *shared = worker->shared;
+
+    int i;
+    while ((i = __atomic_fetch_add(&shared->next, 1, __ATOMIC_RELAXED)) < shared->count)
+        shared->task(i, worker->threadId, shared->context);
+
+    return NULL;
+}
+
+// Number of Worker Threads to use by default
+int parallelThreadCount(void)
+{
+#ifdef _SC_NPROCESSORS_ONLN
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+#else
+    long cpus = pthread_num_processors_np();
+#endif
+    if (cpus < 1)
+        return 1;
+    return (cpus < MAX_THREADS) ? (int)cpus : MAX_THREADS;
+}
+
+// Run task for every Index in [0, count) across threadCount Threads
+// Indices are handed out one at a time so uneven Tasks stay balanced
+void parallelFor(int count, int threadCount, parallelTask task, void *context)
+{
+    if (threadCount > MAX_THREADS)
+        threadCount = MAX_THREADS;
+    if (threadCount > count)
+        threadCount = count;
+
+    if (threadCount <= 1)
+    {
+        for (int i = 0; i < count; i++)
+            task(i, 0, context);
+        return;
+    }
+
+    parallelForShared shared = {count, 0, task, context};
+    parallelForWorker workers[MAX_THREADS];
+    pthread_t threads[MAX_THREADS];
+    int started[MAX_THREADS] = {0};
+
+    // The calling Thread works as Thread 0, Indices left by Threads that fail to start are claimed by the rest
+    for (int t = 0; t < threadCount; t++)
+        workers[t] = (parallelForWorker){&shared, t};
+    for (int t = 1; t < threadCount; t++)
+        started[t] = (pthread_create(&threads[t], NULL, _parallelForRun, &workers[t]) == 0);
+
+    _parallelForRun(&workers[0]);
+
+    for (int t = 1; t < threadCount; t++)
+        if (started[t])
+            pthread_join(threads[t], NULL);
+}
+
+// Wall Clock Time in Seconds
+double parallelTime(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
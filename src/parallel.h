@@ -0,0 +1,17 @@
+#ifndef _PARALLEL_H_
+#define _PARALLEL_H_
+
+#define MAX_THREADS 16
+
+// Task run for every Index of a Parallel Loop
+typedef void (*parallelTask)(
+    int index,     // Loop Index
+    int threadId,  // Worker Thread ID (0 to threadCount - 1)
+    void *context  // Shared Context
+);
+
+int parallelThreadCount(void);
+void parallelFor(int count, int threadCount, parallelTask task, void *context);
+double parallelTime(void);
+
+#endif
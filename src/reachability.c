@@ -0,0 +1,65 @@
+#include "reachability.h"
+
+#include "components.h"
+
+// Initialize an empty Reachability Index
+void reachabilityInit(ReachabilityIndex *index)
+{
+    index->version = 0;
+    index->componentCount = 0;
+}
+
+// Rebuild the Reachability Index if the Graph changed since it was last built
+void reachabilityUpdate(ReachabilityIndex *index, Graph *g)
+{
+    if (index->version == g->version)
+        return;
+
+    int count = stronglyConnectedComponents(g, index->component);
+    index->componentCount = count;
+
+    // Group Vertices by Component
+    int start[MAX_VERTICES + 1] = {0}, members[MAX_VERTICES];
+    for (int i = 0; i < g->n; i++)
+        start[index->component[i] + 1]++;
+    for (int c = 0; c < count; c++)
+        start[c + 1] += start[c];
+    {
+        int fill[MAX_VERTICES];
+        for (int c = 0; c < count; c++)
+            fill[c] = start[c];
+        for (int i = 0; i < g->n; i++)
+            members[fill[index->component[i]]++] = i;
+    }
+
+    // Components are numbered in reverse Topological Order, so every Successor of c is finished before c
+    for (int c = 0; c < count; c++)
+    {
+        for (int w = 0; w < REACH_WORDS; w++)
+            index->reach[c][w] = 0;
+        index->reach[c][c / 64] |= (uint64_t)1 << (c % 64);
+
+        for (int k = start[c]; k < start[c + 1]; k++)
+        {
+            int u = members[k];
+            for (int v = 0; v < g->n; v++)
+            {
+                int d = index->component[v];
+                if (g->adj[u][v] && d != c && !(index->reach[c][d / 64] & ((uint64_t)1 << (d % 64))))
+                    for (int w = 0; w < REACH_WORDS; w++)
+                        index->reach[c][w] |= index->reach[d][w];
+            }
+        }
+    }
+
+    index->version = g->version;
+}
+
+// Check if v can be reached from u, rebuilding the Index first if it is stale
+bool reachable(ReachabilityIndex *index, Graph *g, int u, int v)
+{
+    reachabilityUpdate(index, g);
+
+    int c = index->component[u], d = index->component[v];
+    return (index->reach[c][d / 64] >> (d % 64)) & 1;
+}
@@ -0,0 +1,24 @@
+#ifndef _REACHABILITY_H_
+#define _REACHABILITY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "graph.h"
+
+#define REACH_WORDS ((MAX_VERTICES + 63) / 64)
+
+// Reachability between all Vertex Pairs, cached against a Graph Version
+// Built over the Condensation of the Graph, each Component holds a Bitset of the Components it can reach
+typedef struct reachabilityIndex_t {
+    unsigned int version;                      // Graph Version the Index was built for (0 if never built)
+    int componentCount;                        // Number of Strongly Connected Components
+    int component[MAX_VERTICES];               // Strongly Connected Component of each Vertex
+    uint64_t reach[MAX_VERTICES][REACH_WORDS]; // Components reachable from each Component
+} ReachabilityIndex;
+
+void reachabilityInit(ReachabilityIndex *index);
+void reachabilityUpdate(ReachabilityIndex *index, Graph *g);
+bool reachable(ReachabilityIndex *index, Graph *g, int u, int v);
+
+#endif
@@ -0,0 +1,161 @@
+#include "reorder.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+// Undirected Degree of every Vertex, ignoring Self Loops
+static void _undirectedDegrees(Graph *g, int degree[])
+{
+    for (int u = 0; u < g->n; u++)
+    {
+        degree[u] = 0;
+        for (int v = 0; v < g->n; v++)
+            if (u != v && (g->adj[u][v] || g->adj[v][u]))
+                degree[u]++;
+    }
+}
+
+// Breadth-First Search over undirected Edges appending to order, Neighbours taken by ascending Degree if byDegree
+// Returns the new Length of order, with Hop Counts from root in level if given
+static int _undirectedBfs(Graph *g, int root, bool visited[], int degree[], bool byDegree, int order[], int length, int level[])
+{
+    int front = length;
+
+    visited[root] = true;
+    order[length++] = root;
+    if (level)
+        level[root] = 0;
+    while (front < length) {
+        int u = order[front++], start = length;
+
+        for (int v = 0; v < g->n; v++)
+            if (!visited[v] && u != v && (g->adj[u][v] || g->adj[v][u]))
+            {
+                visited[v] = true;
+                order[length++] = v;
+                if (level)
+                    level[v] = level[u] + 1;
+            }
+
+        // Insertion Sort the new Neighbours by Degree, Ties keep Index Order
+        if (byDegree)
+            for (int i = start + 1; i < length; i++)
+                for (int j = i; j > start && degree[order[j - 1]] > degree[order[j]]; j--)
+                {
+                    int swap = order[j];
+                    order[j] = order[j - 1];
+                    order[j - 1] = swap;
+                }
+    }
+
+    return length;
+}
+
+// Compute a Vertex Order for better Locality of the Adjacency Matrix, Edges taken as undirected
+// Reverse Cuthill-McKee starts each Component from a pseudo-peripheral Vertex found by repeated Searches
+void reorderPermutation(Graph *g, ReorderMethod method, Permutation *perm)
+{
+    int n = g->n, degree[MAX_VERTICES], order[MAX_VERTICES], length = 0;
+    bool visited[MAX_VERTICES] = {false};
+
+    _undirectedDegrees(g, degree);
+    perm->n = n;
+
+    if (method == REORDER_DEGREE)
+    {
+        for (int v = 0; v < n; v++)
+        {
+            int i = length++;
+            for (; i > 0 && degree[order[i - 1]] < degree[v]; i--)
+                order[i] = order[i - 1];
+            order[i] = v;
+        }
+    }
+    else
+    {
+        for (int c = 0; c < n; c++)
+        {
+            if (visited[c])
+                continue;
+
+            int root = c;
+            if (method == REORDER_RCM)
+            {
+                // The smallest Degree Vertex of the Component, then the far End of Searches from it while they grow deeper
+                bool seen[MAX_VERTICES] = {false};
+                int component[MAX_VERTICES], level[MAX_VERTICES];
+                int size = _undirectedBfs(g, c, seen, degree, false, component, 0, NULL);
+                for (int i = 0; i < size; i++)
+                    if (degree[component[i]] < degree[root])
+                        root = component[i];
+
+                for (int depth = -1; ; )
+                {
+                    for (int i = 0; i < size; i++)
+                        seen[component[i]] = false;
+                    size = _undirectedBfs(g, root, seen, degree, true, component, 0, level);
+                    int far = component[size - 1];
+                    for (int i = 0; i < size; i++)
+                        if (level[component[i]] == level[far] && degree[component[i]] < degree[far])
+                            far = component[i];
+                    if (level[far] <= depth)
+                        break;
+                    depth = level[far];
+                    root = far;
+                }
+            }
+            length = _undirectedBfs(g, root, visited, degree, method == REORDER_RCM, order, length, NULL);
+        }
+
+        if (method == REORDER_RCM)
+            for (int i = 0; i < n / 2; i++)
+            {
+                int swap = order[i];
+                order[i] = order[n - 1 - i];
+                order[n - 1 - i] = swap;
+            }
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        perm->oldIndex[i] = order[i];
+        perm->newIndex[order[i]] = i;
+    }
+}
+
+// Copy g into out with Vertices in the Permutation's Order, Labels travel with their Vertices
+// out must not be initialized, returns 0 on Success and -1 if the Permutation does not fit the Graph
+int permuteGraph(Graph *g, Permutation *perm, Graph *out)
+{
+    if (perm->n != g->n)
+        return -1;
+    return inducedSubgraph(g, perm->oldIndex, perm->n, out);
+}
+
+// Map Values indexed by new Vertex back to old Vertex Indices
+void permuteBack(Permutation *perm, int values[], int out[])
+{
+    for (int i = 0; i < perm->n; i++)
+        out[perm->oldIndex[i]] = values[i];
+}
+
+// Largest Index Distance between the Ends of an Edge, with the mean Distance over all Edges in averageSpan
+int adjacencyBandwidth(Graph *g, double *averageSpan)
+{
+    int bandwidth = 0;
+    long long total = 0, edges = 0;
+
+    for (int u = 0; u < g->n; u++)
+        for (int v = 0; v < g->n; v++)
+            if (g->adj[u][v])
+            {
+                int span = abs(u - v);
+                if (span > bandwidth)
+                    bandwidth = span;
+                total += span;
+                edges++;
+            }
+    if (averageSpan)
+        *averageSpan = edges ? (double)total / edges : 0.0;
+    return bandwidth;
+}
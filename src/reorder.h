@@ -0,0 +1,25 @@
+#ifndef _REORDER_H_
+#define _REORDER_H_
+
+#include "graph.h"
+
+// Vertex Orders
+typedef enum reorderMethod {
+    REORDER_RCM = 0, // Reverse Cuthill-McKee
+    REORDER_DEGREE,  // Descending Degree
+    REORDER_BFS,     // Breadth-First Visit Order
+} ReorderMethod;
+
+// Relabelling of Vertex Indices
+typedef struct permutation_t {
+    int n;                        // Number of Vertices
+    int newIndex[MAX_VERTICES];   // New Index of each old Vertex
+    int oldIndex[MAX_VERTICES];   // Old Index of each new Vertex
+} Permutation;
+
+void reorderPermutation(Graph *g, ReorderMethod method, Permutation *perm);
+int permuteGraph(Graph *g, Permutation *perm, Graph *out);
+void permuteBack(Permutation *perm, int values[], int out[]);
+int adjacencyBandwidth(Graph *g, double *averageSpan);
+
+#endif
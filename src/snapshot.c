@@ -0,0 +1,55 @@
+#include "snapshot.h"
+
+#include <limits.h>
+
+// Empty Snapshot, shown before a Run has published anything
+static void _clear(AlgorithmSnapshot *snapshot)
+{
+    snapshot->step = 0;
+    snapshot->current = snapshot->src = snapshot->dest = -1;
+    snapshot->childrenTop = 0;
+    snapshot->front = snapshot->rear = 0;
+    snapshot->pathHead = MAX_VERTICES;
+    for (int i = 0; i < MAX_VERTICES; i++)
+    {
+        snapshot->visited[i] = false;
+        snapshot->distance[i] = INT_MAX;
+        snapshot->previous[i] = -1;
+    }
+}
+
+// Empty all Slots, only while neither Thread is using the Buffer
+void snapshotInit(SnapshotBuffer *buffer)
+{
+    for (int slot = 0; slot < 3; slot++)
+        _clear(&buffer->slots[slot]);
+    buffer->back = 0;
+    atomic_store_explicit(&buffer->middle, 1, memory_order_relaxed);
+    buffer->front = 2;
+    buffer->published = 0;
+}
+
+// Slot the Writer fills next, still holding an older Snapshot
+AlgorithmSnapshot *snapshotBack(SnapshotBuffer *buffer)
+{
+    return &buffer->slots[buffer->back];
+}
+
+// Hand the back Slot to the Reader, taking the middle one back for the next Snapshot
+void snapshotPublish(SnapshotBuffer *buffer)
+{
+    buffer->slots[buffer->back].step = ++buffer->published;
+    int previous = atomic_exchange_explicit(&buffer->middle, buffer->back | SNAPSHOT_FRESH, memory_order_acq_rel);
+    buffer->back = previous & ~SNAPSHOT_FRESH;
+}
+
+// Latest published Snapshot, which stays untouched until the next Call
+AlgorithmSnapshot *snapshotRead(SnapshotBuffer *buffer)
+{
+    if (atomic_load_explicit(&buffer->middle, memory_order_relaxed) & SNAPSHOT_FRESH)
+    {
+        int previous = atomic_exchange_explicit(&buffer->middle, buffer->front, memory_order_acq_rel);
+        buffer->front = previous & ~SNAPSHOT_FRESH;
+    }
+    return &buffer->slots[buffer->front];
+}
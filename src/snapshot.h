@@ -0,0 +1,44 @@
+#ifndef _SNAPSHOT_H_
+#define _SNAPSHOT_H_
+
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "graph.h"
+
+#define SNAPSHOT_FRESH 4
+
+// State of a Search at one Step, as the Render Thread draws it
+typedef struct algorithmSnapshot_t {
+    int step;                             // Number of this Snapshot in the Run, counting from 1
+    int current;                          // Current Vertex (-1 if none)
+    int src;                              // Source Vertex (-1 if none)
+    int dest;                             // Destination Vertex (-1 if none)
+    int childrenTop;                      // Number of Children
+    int children[MAX_VERTICES];           // Vertices discovered from the Current one in this Step
+    bool visited[MAX_VERTICES];           // Visited Vertices
+    int front, rear;                      // Pending Vertices are items[front, rear) (Queue or Stack)
+    int items[MAX_VERTICES];              // BFS Queue or DFS Stack
+    int distance[MAX_VERTICES];           // Dijkstra Distances
+    int previous[MAX_VERTICES];           // Dijkstra Parents (-1 if none)
+    int pathHead;                         // Start of the Dijkstra Path (MAX_VERTICES if none)
+    int path[MAX_VERTICES];               // Dijkstra Path, filled from the Back
+} AlgorithmSnapshot;
+
+// Triple Buffer handing Snapshots from one Worker Thread to the Render Thread without Locks
+// The Writer fills its back Slot and swaps it with the middle one, the Reader swaps the middle Slot with its
+// front one only when a fresh Snapshot is waiting, so neither ever waits and the Reader never sees a Slot being written
+typedef struct snapshotBuffer_t {
+    AlgorithmSnapshot slots[3];           // Back, middle and front Slot in some Order
+    int back;                             // Slot owned by the Writer
+    int front;                            // Slot owned by the Reader
+    int published;                        // Snapshots published, owned by the Writer
+    atomic_int middle;                    // Slot in between, with SNAPSHOT_FRESH set while it is unread
+} SnapshotBuffer;
+
+void snapshotInit(SnapshotBuffer *buffer);
+AlgorithmSnapshot *snapshotBack(SnapshotBuffer *buffer);
+void snapshotPublish(SnapshotBuffer *buffer);
+AlgorithmSnapshot *snapshotRead(SnapshotBuffer *buffer);
+
+#endif
@@ -0,0 +1,202 @@
+#include "spanningTree.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "parallel.h"
+#include "unionFind.h"
+
+// Undirected Edge considered by the Spanning Forest
+typedef struct spanningEdge_t {
+    int from;   // Source Vertex
+    int to;     // Destination Vertex
+    int weight; // Edge Weight
+} spanningEdge;
+
+// Collect the Undirected Edges of the Graph, returns the Edge Count
+// With undirected set an Edge in either Direction counts, otherwise only Edges present in both Directions do
+// Either way the lighter Direction is kept
+static int _collectEdges(Graph *g, bool undirected, spanningEdge edges[])
+{
+    int count = 0;
+    for (int u = 0; u < g->n; u++)
+        for (int v = u + 1; v < g->n; v++)
+        {
+            int forward = g->adj[u][v], backward = g->adj[v][u];
+            if (!forward && !backward)
+                continue;
+            if (!undirected && !(forward && backward))
+                continue;
+
+            if (forward && (!backward || forward <= backward))
+                edges[count++] = (spanningEdge){u, v, forward};
+            else
+                edges[count++] = (spanningEdge){v, u, backward};
+        }
+    return count;
+}
+
+// Initialize an empty Spanning Forest
+void spanningForestInit(SpanningForest *forest)
+{
+    forest->version = 0;
+    forest->edgeCount = 0;
+    forest->totalWeight = 0;
+    forest->treeCount = 0;
+}
+
+// Reset the Forest before Edges are added
+static void _forestReset(Graph *g, SpanningForest *forest)
+{
+    forest->edgeCount = 0;
+    forest->totalWeight = 0;
+    forest->treeCount = g->n;
+}
+
+// Add an Edge to the Forest
+static void _forestAdd(SpanningForest *forest, spanningEdge edge)
+{
+    forest->from[forest->edgeCount] = edge.from;
+    forest->to[forest->edgeCount] = edge.to;
+    forest->weight[forest->edgeCount] = edge.weight;
+    forest->edgeCount++;
+    forest->totalWeight += edge.weight;
+    forest->treeCount--;
+}
+
+// Order Edges by Weight, then by Position so that Ties are broken the same way everywhere
+static int _compareEdges(const void *a, const void *b)
+{
+    const spanningEdge *edgeA = (const spanningEdge *)a, *edgeB = (const spanningEdge *)b;
+    if (edgeA->weight != edgeB->weight)
+        return (edgeA->weight < edgeB->weight) ? -1 : 1;
+    if (edgeA->from != edgeB->from)
+        return (edgeA->from < edgeB->from) ? -1 : 1;
+    return (edgeA->to > edgeB->to) - (edgeA->to < edgeB->to);
+}
+
+// Minimum Spanning Forest using Kruskal's Algorithm, returns the Edge Count
+int kruskalSpanningForest(Graph *g, bool undirected, SpanningForest *forest)
+{
+    spanningEdge edges[MAX_EDGES];
+    int parent[MAX_VERTICES];
+
+    int edgeCount = _collectEdges(g, undirected, edges);
+    qsort(edges, edgeCount, sizeof(spanningEdge), _compareEdges);
+
+    _forestReset(g, forest);
+    unionFindInit(parent, g->n);
+    for (int i = 0; i < edgeCount && forest->edgeCount < g->n - 1; i++)
+        if (unionFindUnion(parent, edges[i].from, edges[i].to))
+            _forestAdd(forest, edges[i]);
+
+    forest->version = g->version;
+    return forest->edgeCount;
+}
+
+//----------------------------------------------------------------------------------
+// Parallel Boruvka
+
+#define NO_EDGE UINT64_MAX
+
+typedef struct boruvkaShared_t {
+    spanningEdge *edges;            // Edges of the Graph
+    int edgeCount;                  // Number of Edges
+    int *parent;                    // Union-Find Parents
+    uint64_t cheapest[MAX_VERTICES];// Cheapest Edge Key leaving each Component
+} boruvkaShared;
+
+// Pack an Edge into a Key ordered by Weight, then by Edge Index
+static uint64_t _edgeKey(spanningEdge *edges, int i)
+{
+    return ((uint64_t)((uint32_t)edges[i].weight ^ 0x80000000u) << 32) | (uint32_t)i;
+}
+
+// Lower a Component's Cheapest Edge Key without Locks
+static void _offerCheapest(uint64_t *slot, uint64_t key)
+{
+    uint64_t current = __atomic_load_n(slot, __ATOMIC_RELAXED);
+    while (key < current && !__atomic_compare_exchange_n(slot, &current, key, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        ;
+}
+
+// Offer a Block of Edges to the Components on both of their Ends
+static void _boruvkaBlock(int block, int threadId, void *context)
+{
+    (void)threadId;
+    boruvkaShared *shared = (boruvkaShared *)context;
+
+    int end = (block + 1) * MAX_VERTICES;
+    if (end > shared->edgeCount)
+        end = shared->edgeCount;
+
+    for (int i = block * MAX_VERTICES; i < end; i++)
+    {
+        int a = unionFindFind(shared->parent, shared->edges[i].from);
+        int b = unionFindFind(shared->parent, shared->edges[i].to);
+        if (a == b)
+            continue;
+
+        uint64_t key = _edgeKey(shared->edges, i);
+        _offerCheapest(&shared->cheapest[a], key);
+        _offerCheapest(&shared->cheapest[b], key);
+    }
+}
+
+// Minimum Spanning Forest using Boruvka's Algorithm across threadCount Threads, returns the Edge Count
+// Every Round each Component picks its cheapest leaving Edge in parallel, then the picks are contracted
+int boruvkaSpanningForest(Graph *g, bool undirected, SpanningForest *forest, int threadCount)
+{
+    spanningEdge edges[MAX_EDGES];
+    int parent[MAX_VERTICES];
+    boruvkaShared shared;
+
+    shared.edges = edges;
+    shared.edgeCount = _collectEdges(g, undirected, edges);
+    shared.parent = parent;
+
+    _forestReset(g, forest);
+    unionFindInit(parent, g->n);
+
+    int blocks = (shared.edgeCount + MAX_VERTICES - 1) / MAX_VERTICES;
+    bool merged = true;
+    while (merged) {
+        merged = false;
+        for (int i = 0; i < g->n; i++)
+            shared.cheapest[i] = NO_EDGE;
+
+        parallelFor(blocks, threadCount, _boruvkaBlock, &shared);
+
+        // Two Components may pick the same Edge, the second Union then fails and it is not added twice
+        for (int i = 0; i < g->n; i++)
+        {
+            if (shared.cheapest[i] == NO_EDGE)
+                continue;
+
+            spanningEdge edge = edges[(uint32_t)shared.cheapest[i]];
+            if (unionFindUnion(parent, edge.from, edge.to))
+            {
+                _forestAdd(forest, edge);
+                merged = true;
+            }
+        }
+    }
+
+    forest->version = g->version;
+    return forest->edgeCount;
+}
+//----------------------------------------------------------------------------------
+
+// Minimum Spanning Forest, using Kruskal's Algorithm for small Graphs and parallel Boruvka otherwise
+int minimumSpanningForest(Graph *g, bool undirected, SpanningForest *forest)
+{
+    int edgeCount = 0;
+    for (int u = 0; u < g->n; u++)
+        for (int v = 0; v < g->n; v++)
+            if (g->adj[u][v])
+                edgeCount++;
+
+    if (edgeCount <= KRUSKAL_MAX_EDGES)
+        return kruskalSpanningForest(g, undirected, forest);
+    return boruvkaSpanningForest(g, undirected, forest, parallelThreadCount());
+}
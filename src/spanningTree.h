@@ -0,0 +1,27 @@
+#ifndef _SPANNING_TREE_H_
+#define _SPANNING_TREE_H_
+
+#include <stdbool.h>
+
+#include "graph.h"
+
+#define MAX_EDGES (MAX_VERTICES * (MAX_VERTICES - 1) / 2)
+#define KRUSKAL_MAX_EDGES 256
+
+// Minimum Spanning Forest of a Graph
+typedef struct spanningForest_t {
+    unsigned int version;    // Graph Version the Forest was built for (0 if never built)
+    int edgeCount;           // Number of Edges in the Forest
+    int from[MAX_VERTICES];  // Edge Source Vertices (adj[from][to] is an Edge of the Graph)
+    int to[MAX_VERTICES];    // Edge Destination Vertices
+    int weight[MAX_VERTICES];// Edge Weights
+    long long totalWeight;   // Sum of all Edge Weights
+    int treeCount;           // Number of Trees in the Forest
+} SpanningForest;
+
+void spanningForestInit(SpanningForest *forest);
+int kruskalSpanningForest(Graph *g, bool undirected, SpanningForest *forest);
+int boruvkaSpanningForest(Graph *g, bool undirected, SpanningForest *forest, int threadCount);
+int minimumSpanningForest(Graph *g, bool undirected, SpanningForest *forest);
+
+#endif
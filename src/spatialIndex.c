@@ -0,0 +1,440 @@
+#include "spatialIndex.h"
+
+#include <stdlib.h>
+#include <math.h>
+
+// Cell Coordinate of a Position along one Axis
+static inline int _cell(SpatialIndex *index, float x)
+{
+    return (int)floorf(x / index->cellSize);
+}
+
+// Bucket holding a Cell
+static inline int _bucket(int cx, int cy)
+{
+    return (int)(((unsigned int)cx * 73856093U ^ (unsigned int)cy * 19349663U) % SPATIAL_BUCKETS);
+}
+
+// Squared Distance between two Positions
+static inline float _distanceSquared(Vector2 a, Vector2 b)
+{
+    return (a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y);
+}
+
+// Squared Distance from a Position to the Segment a-b
+static float _segmentDistanceSquared(Vector2 p, Vector2 a, Vector2 b)
+{
+    float dx = b.x - a.x, dy = b.y - a.y, lengthSquared = dx * dx + dy * dy;
+    float t = (lengthSquared > 0.0f) ? ((p.x - a.x) * dx + (p.y - a.y) * dy) / lengthSquared : 0.0f;
+    if (t < 0.0f)
+        t = 0.0f;
+    if (t > 1.0f)
+        t = 1.0f;
+    return _distanceSquared(p, (Vector2){a.x + t * dx, a.y + t * dy});
+}
+
+// Check if a Position lies inside a Rectangle, Edges included
+static inline bool _pointInRect(Vector2 p, Rectangle rect)
+{
+    return p.x >= rect.x && p.x <= rect.x + rect.width && p.y >= rect.y && p.y <= rect.y + rect.height;
+}
+
+// Check if the Segment a-b touches a Rectangle, clipping it against each Side in turn (Liang-Barsky)
+static bool _segmentInRect(Vector2 a, Vector2 b, Rectangle rect)
+{
+    float dx = b.x - a.x, dy = b.y - a.y, t0 = 0.0f, t1 = 1.0f;
+    float p[4] = {-dx, dx, -dy, dy};
+    float q[4] = {a.x - rect.x, rect.x + rect.width - a.x, a.y - rect.y, rect.y + rect.height - a.y};
+
+    for (int side = 0; side < 4; side++)
+    {
+        if (p[side] == 0.0f)
+        {
+            if (q[side] < 0.0f)
+                return false;
+            continue;
+        }
+        float t = q[side] / p[side];
+        if (p[side] < 0.0f)
+        {
+            if (t > t1)
+                return false;
+            if (t > t0)
+                t0 = t;
+        }
+        else
+        {
+            if (t < t0)
+                return false;
+            if (t < t1)
+                t1 = t;
+        }
+    }
+    return true;
+}
+
+// Check if a Rectangle covers more Cells than there are Buckets, making a Scan of everything cheaper
+static bool _rectTooLarge(SpatialIndex *index, Rectangle rect)
+{
+    long long columns = (long long)_cell(index, rect.x + rect.width) - _cell(index, rect.x) + 1;
+    long long rows = (long long)_cell(index, rect.y + rect.height) - _cell(index, rect.y) + 1;
+    return columns * rows > SPATIAL_BUCKETS;
+}
+
+// Link a Point into the Bucket of its Position
+static void _insertVertex(SpatialIndex *index, int v)
+{
+    int bucket = _bucket(_cell(index, index->points[v].x), _cell(index, index->points[v].y));
+    index->vertexBucket[v] = bucket;
+    index->vertexPrev[v] = -1;
+    index->vertexNext[v] = index->vertexHead[bucket];
+    if (index->vertexHead[bucket] != -1)
+        index->vertexPrev[index->vertexHead[bucket]] = v;
+    index->vertexHead[bucket] = v;
+}
+
+// Unlink a Point from its Bucket
+static void _removeVertex(SpatialIndex *index, int v)
+{
+    if (index->vertexPrev[v] != -1)
+        index->vertexNext[index->vertexPrev[v]] = index->vertexNext[v];
+    else
+        index->vertexHead[index->vertexBucket[v]] = index->vertexNext[v];
+    if (index->vertexNext[v] != -1)
+        index->vertexPrev[index->vertexNext[v]] = index->vertexPrev[v];
+}
+
+// Take a free Entry, growing the Pool if needed, returns -1 if it could not grow
+static int _allocateEntry(SpatialIndex *index)
+{
+    if (index->freeEntry == -1)
+    {
+        int capacity = (index->capacity > 0) ? 2 * index->capacity : 1024;
+        int **arrays[5] = {&index->entryEdge, &index->entryBucket, &index->entryNext, &index->entryPrev, &index->entrySibling};
+        for (int a = 0; a < 5; a++)
+        {
+            int *grown = (int *)realloc(*arrays[a], capacity * sizeof(int));
+            if (grown == NULL)
+                return -1;
+            *arrays[a] = grown;
+        }
+
+        for (int e = capacity - 1; e >= index->capacity; e--)
+        {
+            index->entrySibling[e] = index->freeEntry;
+            index->freeEntry = e;
+        }
+        index->capacity = capacity;
+    }
+
+    int entry = index->freeEntry;
+    index->freeEntry = index->entrySibling[entry];
+    return entry;
+}
+
+// Add an Entry for an Edge to the Bucket of one Cell
+static void _addEdgeEntry(SpatialIndex *index, int edge, int cx, int cy)
+{
+    int bucket = _bucket(cx, cy);
+
+    // A long Edge can revisit a Bucket through a hashed Collision, one Entry per Bucket is enough
+    for (int e = index->edgeFirst[edge]; e != -1; e = index->entrySibling[e])
+        if (index->entryBucket[e] == bucket)
+            return;
+
+    int entry = _allocateEntry(index);
+    if (entry == -1)
+        return;
+    index->entryEdge[entry] = edge;
+    index->entryBucket[entry] = bucket;
+    index->entryPrev[entry] = -1;
+    index->entryNext[entry] = index->edgeHead[bucket];
+    if (index->edgeHead[bucket] != -1)
+        index->entryPrev[index->edgeHead[bucket]] = entry;
+    index->edgeHead[bucket] = entry;
+    index->entrySibling[entry] = index->edgeFirst[edge];
+    index->edgeFirst[edge] = entry;
+}
+
+// Index an Edge in every Cell its Segment passes through, walking the Grid with a Digital Differential Analyzer
+static void _insertEdge(SpatialIndex *index, int u, int v)
+{
+    Vector2 a = index->points[u], b = index->points[v];
+    int edge = u * MAX_VERTICES + v;
+    int cx = _cell(index, a.x), cy = _cell(index, a.y), endX = _cell(index, b.x), endY = _cell(index, b.y);
+    float dx = b.x - a.x, dy = b.y - a.y;
+    int stepX = (dx > 0) - (dx < 0), stepY = (dy > 0) - (dy < 0);
+    float deltaX = (dx != 0.0f) ? fabsf(index->cellSize / dx) : INFINITY;
+    float deltaY = (dy != 0.0f) ? fabsf(index->cellSize / dy) : INFINITY;
+    float nextX = (dx != 0.0f) ? (((stepX > 0) ? (cx + 1) * index->cellSize : cx * index->cellSize) - a.x) / dx : INFINITY;
+    float nextY = (dy != 0.0f) ? (((stepY > 0) ? (cy + 1) * index->cellSize : cy * index->cellSize) - a.y) / dy : INFINITY;
+
+    _addEdgeEntry(index, edge, cx, cy);
+    for (int steps = abs(endX - cx) + abs(endY - cy); steps > 0; steps--)
+    {
+        if (nextX < nextY)
+        {
+            cx += stepX;
+            nextX += deltaX;
+        }
+        else
+        {
+            cy += stepY;
+            nextY += deltaY;
+        }
+        _addEdgeEntry(index, edge, cx, cy);
+    }
+}
+
+// Drop every Entry of an Edge
+static void _removeEdge(SpatialIndex *index, int edge)
+{
+    int entry = index->edgeFirst[edge];
+    while (entry != -1) {
+        int sibling = index->entrySibling[entry];
+        if (index->entryPrev[entry] != -1)
+            index->entryNext[index->entryPrev[entry]] = index->entryNext[entry];
+        else
+            index->edgeHead[index->entryBucket[entry]] = index->entryNext[entry];
+        if (index->entryNext[entry] != -1)
+            index->entryPrev[index->entryNext[entry]] = index->entryPrev[entry];
+        index->entrySibling[entry] = index->freeEntry;
+        index->freeEntry = entry;
+        entry = sibling;
+    }
+    index->edgeFirst[edge] = -1;
+}
+
+// Initialize an empty Spatial Index with Cells of the given Size
+void spatialIndexInit(SpatialIndex *index, float cellSize)
+{
+    index->cellSize = cellSize;
+    index->count = 0;
+    index->version = 0;
+    index->entryEdge = NULL;
+    index->entryBucket = NULL;
+    index->entryNext = NULL;
+    index->entryPrev = NULL;
+    index->entrySibling = NULL;
+    index->capacity = 0;
+    index->freeEntry = -1;
+    for (int b = 0; b < SPATIAL_BUCKETS; b++)
+        index->vertexHead[b] = index->edgeHead[b] = -1;
+    for (int e = 0; e < MAX_VERTICES * MAX_VERTICES; e++)
+        index->edgeFirst[e] = -1;
+}
+
+// Free the Edge Entries
+void spatialIndexDeinit(SpatialIndex *index)
+{
+    free(index->entryEdge);
+    free(index->entryBucket);
+    free(index->entryNext);
+    free(index->entryPrev);
+    free(index->entrySibling);
+    spatialIndexInit(index, index->cellSize);
+}
+
+// Index every Point and Edge from scratch
+void spatialIndexBuild(SpatialIndex *index, Graph *g, Vector2 *points, int count)
+{
+    for (int u = 0; u < index->count; u++)
+        for (int v = 0; v < index->count; v++)
+            if (index->edgeFirst[u * MAX_VERTICES + v] != -1)
+                _removeEdge(index, u * MAX_VERTICES + v);
+    for (int b = 0; b < SPATIAL_BUCKETS; b++)
+        index->vertexHead[b] = -1;
+
+    index->count = (count < g->n) ? count : g->n;
+    for (int v = 0; v < index->count; v++)
+    {
+        index->points[v] = points[v];
+        _insertVertex(index, v);
+    }
+    for (int u = 0; u < index->count; u++)
+        for (int v = 0; v < index->count; v++)
+            if (g->adj[u][v] >= 1 && u != v)
+                _insertEdge(index, u, v);
+    index->version = g->version;
+}
+
+// Move one Point, re-indexing only the Edges that touch it
+void spatialIndexMove(SpatialIndex *index, Graph *g, int v, Vector2 position)
+{
+    if (v < 0 || v >= index->count)
+        return;
+
+    _removeVertex(index, v);
+    index->points[v] = position;
+    _insertVertex(index, v);
+
+    for (int w = 0; w < index->count; w++)
+    {
+        if (w == v)
+            continue;
+        if (index->edgeFirst[v * MAX_VERTICES + w] != -1)
+            _removeEdge(index, v * MAX_VERTICES + w);
+        if (index->edgeFirst[w * MAX_VERTICES + v] != -1)
+            _removeEdge(index, w * MAX_VERTICES + v);
+        if (g->adj[v][w] >= 1)
+            _insertEdge(index, v, w);
+        if (g->adj[w][v] >= 1)
+            _insertEdge(index, w, v);
+    }
+}
+
+// Bring the Index up to date, rebuilding after Graph Changes and moving only Points whose Position changed
+void spatialIndexSync(SpatialIndex *index, Graph *g, Vector2 *points, int count)
+{
+    if (count > g->n)
+        count = g->n;
+    if (index->version != g->version || index->count != count)
+    {
+        spatialIndexBuild(index, g, points, count);
+        return;
+    }
+    for (int v = 0; v < count; v++)
+        if (index->points[v].x != points[v].x || index->points[v].y != points[v].y)
+            spatialIndexMove(index, g, v, points[v]);
+}
+
+// Closest Point within radius of a Position, or -1 if there is none
+int spatialVertexAt(SpatialIndex *index, Vector2 position, float radius)
+{
+    int best = -1, reach = (int)ceilf(radius / index->cellSize);
+    int cx = _cell(index, position.x), cy = _cell(index, position.y);
+    float bestDistance = radius * radius;
+
+    for (int y = cy - reach; y <= cy + reach; y++)
+        for (int x = cx - reach; x <= cx + reach; x++)
+            for (int v = index->vertexHead[_bucket(x, y)]; v != -1; v = index->vertexNext[v])
+            {
+                float d = _distanceSquared(position, index->points[v]);
+                if (d <= bestDistance && (best == -1 || d < bestDistance || v < best))
+                {
+                    best = v;
+                    bestDistance = d;
+                }
+            }
+    return best;
+}
+
+// Closest Point to a Position searching Rings of Cells outwards, or -1 if nothing is indexed
+// A Point found in Ring r may still lose to one in a later Ring, so the Search continues until Rings lie beyond it
+int spatialNearestVertex(SpatialIndex *index, Vector2 position)
+{
+    int best = -1, cx = _cell(index, position.x), cy = _cell(index, position.y);
+    float bestDistance = 0.0f;
+
+    if (index->count == 0)
+        return -1;
+
+    for (int r = 0; r <= SPATIAL_MAX_RINGS; r++)
+    {
+        if (best != -1 && (r - 1) * index->cellSize > sqrtf(bestDistance))
+            return best;
+        for (int y = cy - r; y <= cy + r; y++)
+            for (int x = cx - r; x <= cx + r; x += (y == cy - r || y == cy + r) ? 1 : 2 * r)
+            {
+                for (int v = index->vertexHead[_bucket(x, y)]; v != -1; v = index->vertexNext[v])
+                {
+                    float d = _distanceSquared(position, index->points[v]);
+                    if (best == -1 || d < bestDistance)
+                    {
+                        best = v;
+                        bestDistance = d;
+                    }
+                }
+                if (r == 0)
+                    break;
+            }
+    }
+
+    // Far from every Cell searched, fall back to checking every Point
+    for (int v = 0; v < index->count; v++)
+        if (best == -1 || _distanceSquared(position, index->points[v]) < bestDistance)
+        {
+            best = v;
+            bestDistance = _distanceSquared(position, index->points[v]);
+        }
+    return best;
+}
+
+// Closest Edge within tolerance of a Position, returns false if there is none
+bool spatialEdgeAt(SpatialIndex *index, Vector2 position, float tolerance, int *u, int *v)
+{
+    int best = -1, reach = (int)ceilf(tolerance / index->cellSize);
+    int cx = _cell(index, position.x), cy = _cell(index, position.y);
+    float bestDistance = tolerance * tolerance;
+
+    for (int y = cy - reach; y <= cy + reach; y++)
+        for (int x = cx - reach; x <= cx + reach; x++)
+            for (int e = index->edgeHead[_bucket(x, y)]; e != -1; e = index->entryNext[e])
+            {
+                int edge = index->entryEdge[e];
+                float d = _segmentDistanceSquared(position, index->points[edge / MAX_VERTICES], index->points[edge % MAX_VERTICES]);
+                if (d <= bestDistance && (best == -1 || d < bestDistance || edge < best))
+                {
+                    best = edge;
+                    bestDistance = d;
+                }
+            }
+
+    if (best == -1)
+        return false;
+    *u = best / MAX_VERTICES;
+    *v = best % MAX_VERTICES;
+    return true;
+}
+
+// Points inside a Rectangle in ascending Order, returns their Count
+int spatialVerticesInRect(SpatialIndex *index, Rectangle rect, int vertices[])
+{
+    bool inside[MAX_VERTICES] = {false};
+    int found = 0;
+
+    if (_rectTooLarge(index, rect))
+        for (int v = 0; v < index->count; v++)
+            inside[v] = _pointInRect(index->points[v], rect);
+    else
+        for (int y = _cell(index, rect.y); y <= _cell(index, rect.y + rect.height); y++)
+            for (int x = _cell(index, rect.x); x <= _cell(index, rect.x + rect.width); x++)
+                for (int v = index->vertexHead[_bucket(x, y)]; v != -1; v = index->vertexNext[v])
+                    if (_pointInRect(index->points[v], rect))
+                        inside[v] = true;
+
+    for (int v = 0; v < index->count; v++)
+        if (inside[v])
+            vertices[found++] = v;
+    return found;
+}
+
+// Edges whose Segment touches a Rectangle as u * MAX_VERTICES + v in no particular Order, returns their Count
+// Self Loops are never indexed, so they are never returned
+int spatialEdgesInRect(SpatialIndex *index, Rectangle rect, int edges[])
+{
+    bool seen[MAX_VERTICES * MAX_VERTICES] = {false};
+    int found = 0;
+
+    if (_rectTooLarge(index, rect))
+    {
+        for (int u = 0; u < index->count; u++)
+            for (int v = 0; v < index->count; v++)
+                if (index->edgeFirst[u * MAX_VERTICES + v] != -1 && _segmentInRect(index->points[u], index->points[v], rect))
+                    edges[found++] = u * MAX_VERTICES + v;
+        return found;
+    }
+
+    for (int y = _cell(index, rect.y); y <= _cell(index, rect.y + rect.height); y++)
+        for (int x = _cell(index, rect.x); x <= _cell(index, rect.x + rect.width); x++)
+            for (int e = index->edgeHead[_bucket(x, y)]; e != -1; e = index->entryNext[e])
+            {
+                int edge = index->entryEdge[e];
+                if (seen[edge])
+                    continue;
+                seen[edge] = true;
+                if (_segmentInRect(index->points[edge / MAX_VERTICES], index->points[edge % MAX_VERTICES], rect))
+                    edges[found++] = edge;
+            }
+    return found;
+}
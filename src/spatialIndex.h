@@ -0,0 +1,47 @@
+#ifndef _SPATIAL_INDEX_H_
+#define _SPATIAL_INDEX_H_
+
+#include <stdbool.h>
+
+#include "raylib.h"
+
+#include "graph.h"
+
+#define SPATIAL_CELL_SIZE 64.0f
+#define SPATIAL_BUCKETS 1024
+#define SPATIAL_MAX_RINGS 32
+
+// Uniform Grid over the Points and the Edges between them, Cells hashed into a fixed Number of Buckets
+// Every Bucket holds a doubly linked List of Vertices and one of Edge Entries, an Edge having an Entry per Cell it crosses
+typedef struct spatialIndex_t {
+    float cellSize;                                   // Side of a Grid Cell
+    int count;                                        // Number of indexed Points
+    unsigned int version;                             // Graph Version the Edges were indexed for (0 if never indexed)
+    Vector2 points[MAX_VERTICES];                     // Indexed Position of each Point
+    int vertexBucket[MAX_VERTICES];                   // Bucket of each Point
+    int vertexHead[SPATIAL_BUCKETS];                  // First Point in each Bucket (-1 if none)
+    int vertexNext[MAX_VERTICES];                     // Next Point in the same Bucket
+    int vertexPrev[MAX_VERTICES];                     // Previous Point in the same Bucket
+    int edgeHead[SPATIAL_BUCKETS];                    // First Edge Entry in each Bucket (-1 if none)
+    int edgeFirst[MAX_VERTICES * MAX_VERTICES];       // First Entry of each Edge u * MAX_VERTICES + v (-1 if not indexed)
+    int *entryEdge;                                   // Edge of each Entry
+    int *entryBucket;                                 // Bucket of each Entry
+    int *entryNext;                                   // Next Entry in the same Bucket
+    int *entryPrev;                                   // Previous Entry in the same Bucket
+    int *entrySibling;                                // Next Entry of the same Edge, or the next free Entry
+    int capacity;                                     // Allocated Entries
+    int freeEntry;                                    // First free Entry (-1 if none)
+} SpatialIndex;
+
+void spatialIndexInit(SpatialIndex *index, float cellSize);
+void spatialIndexDeinit(SpatialIndex *index);
+void spatialIndexBuild(SpatialIndex *index, Graph *g, Vector2 *points, int count);
+void spatialIndexMove(SpatialIndex *index, Graph *g, int v, Vector2 position);
+void spatialIndexSync(SpatialIndex *index, Graph *g, Vector2 *points, int count);
+int spatialVertexAt(SpatialIndex *index, Vector2 position, float radius);
+int spatialNearestVertex(SpatialIndex *index, Vector2 position);
+bool spatialEdgeAt(SpatialIndex *index, Vector2 position, float tolerance, int *u, int *v);
+int spatialVerticesInRect(SpatialIndex *index, Rectangle rect, int vertices[]);
+int spatialEdgesInRect(SpatialIndex *index, Rectangle rect, int edges[]);
+
+#endif
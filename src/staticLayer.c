@@ -0,0 +1,57 @@
+#include "staticLayer.h"
+
+#include <string.h>
+
+// Create the Layer's Texture, invalid until first drawn
+void staticLayerInit(StaticLayer *layer, int width, int height)
+{
+    layer->target = LoadRenderTexture(width, height);
+    layer->valid = false;
+    layer->keySize = 0;
+    layer->redraws = 0;
+}
+
+// Free the Layer's Texture, must happen before the Window is closed
+void staticLayerDeinit(StaticLayer *layer)
+{
+    UnloadRenderTexture(layer->target);
+    layer->valid = false;
+}
+
+// Force the next staticLayerBegin to redraw
+void staticLayerInvalidate(StaticLayer *layer)
+{
+    layer->valid = false;
+}
+
+// Start redrawing the Layer if the Key differs from the one it was drawn for, returns true if it did
+// Drawing that follows goes into the Texture until staticLayerEnd; Keys longer than the Maximum redraw every Time
+bool staticLayerBegin(StaticLayer *layer, const void *key, size_t keySize)
+{
+    if (layer->valid && keySize == layer->keySize && memcmp(layer->key, key, keySize) == 0)
+        return false;
+
+    layer->valid = (keySize <= STATIC_LAYER_MAX_KEY);
+    if (layer->valid)
+    {
+        memcpy(layer->key, key, keySize);
+        layer->keySize = keySize;
+    }
+    layer->redraws++;
+    BeginTextureMode(layer->target);
+    return true;
+}
+
+// Finish redrawing the Layer
+void staticLayerEnd(StaticLayer *layer)
+{
+    (void)layer;
+    EndTextureMode();
+}
+
+// Draw the Layer over the whole Screen, flipped since Render Textures are stored bottom up
+void staticLayerDraw(StaticLayer *layer)
+{
+    Texture2D texture = layer->target.texture;
+    DrawTextureRec(texture, (Rectangle){0, 0, (float)texture.width, (float)-texture.height}, (Vector2){0, 0}, WHITE);
+}
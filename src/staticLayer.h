@@ -0,0 +1,28 @@
+#ifndef _STATIC_LAYER_H_
+#define _STATIC_LAYER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "raylib.h"
+
+#define STATIC_LAYER_MAX_KEY 2048
+
+// Off-Screen Texture holding the Parts of a Scene that rarely change, drawn each Frame as one textured Quad
+// The Caller describes everything the Layer shows as a Key, and the Layer is only redrawn when the Key changes
+typedef struct staticLayer_t {
+    RenderTexture2D target;               // Texture the Layer is drawn into
+    bool valid;                           // Whether the Texture matches the stored Key
+    size_t keySize;                       // Size of the stored Key
+    unsigned char key[STATIC_LAYER_MAX_KEY]; // Key the Texture was drawn for
+    int redraws;                          // Times the Layer was redrawn
+} StaticLayer;
+
+void staticLayerInit(StaticLayer *layer, int width, int height);
+void staticLayerDeinit(StaticLayer *layer);
+void staticLayerInvalidate(StaticLayer *layer);
+bool staticLayerBegin(StaticLayer *layer, const void *key, size_t keySize);
+void staticLayerEnd(StaticLayer *layer);
+void staticLayerDraw(StaticLayer *layer);
+
+#endif
@@ -4,9 +4,63 @@
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
+#include <unistd.h>
 
+#include "parallel.h"
+#include "trace.h"
 #include "utils.h"
 
+#define LAYOUT_STEP_MICROSECONDS 16000
+
+// Publish the State of a Breadth-First Search for the Render Thread
+static void _publishBfs(bfsThreadData *data, Graph *theGraph)
+{
+    AlgorithmSnapshot *snapshot = snapshotBack(data->snapshots);
+    snapshot->current = *(data->current);
+    snapshot->src = *(data->src);
+    snapshot->dest = *(data->dest);
+    snapshot->childrenTop = *(data->childrenTop);
+    snapshot->front = *(data->qFront);
+    snapshot->rear = *(data->qRear);
+    memcpy(snapshot->children, data->children, *(data->childrenTop) * sizeof(int));
+    memcpy(snapshot->visited, data->visited, theGraph->n * sizeof(bool));
+    memcpy(snapshot->items, data->queue, *(data->qRear) * sizeof(int));
+    snapshotPublish(data->snapshots);
+}
+
+// Publish the State of a Depth-First Search for the Render Thread
+static void _publishDfs(dfsThreadData *data, Graph *theGraph)
+{
+    AlgorithmSnapshot *snapshot = snapshotBack(data->snapshots);
+    snapshot->current = *(data->current);
+    snapshot->src = *(data->src);
+    snapshot->dest = *(data->dest);
+    snapshot->childrenTop = *(data->childrenTop);
+    snapshot->front = 0;
+    snapshot->rear = *(data->sTop);
+    memcpy(snapshot->children, data->children, *(data->childrenTop) * sizeof(int));
+    memcpy(snapshot->visited, data->visited, theGraph->n * sizeof(bool));
+    memcpy(snapshot->items, data->stack, *(data->sTop) * sizeof(int));
+    snapshotPublish(data->snapshots);
+}
+
+// Publish the State of Dijkstra's Algorithm for the Render Thread
+static void _publishDijkstra(dijkstraThreadData *data, Graph *theGraph)
+{
+    AlgorithmSnapshot *snapshot = snapshotBack(data->snapshots);
+    snapshot->current = *(data->current);
+    snapshot->src = *(data->src);
+    snapshot->dest = *(data->dest);
+    snapshot->childrenTop = *(data->childrenTop);
+    snapshot->pathHead = *(data->pathHead);
+    memcpy(snapshot->children, data->children, *(data->childrenTop) * sizeof(int));
+    memcpy(snapshot->visited, data->visited, theGraph->n * sizeof(bool));
+    memcpy(snapshot->distance, data->distance, theGraph->n * sizeof(int));
+    memcpy(snapshot->previous, data->previous, theGraph->n * sizeof(int));
+    memcpy(snapshot->path + *(data->pathHead), data->path + *(data->pathHead), (MAX_VERTICES - *(data->pathHead)) * sizeof(int));
+    snapshotPublish(data->snapshots);
+}
+
 // Thread Function to read Graph CSV File
 //----------------------------------------------------------------------------------
 void *csvThread(void *arg)
@@ -14,20 +68,29 @@ void *csvThread(void *arg)
     // TODO: Add Error Handling
     csvThreadData *data = (csvThreadData *)arg;
     *(data->status) = IN_PROGRESS;
+    traceThreadName("CSV Loader");
 
     char *csvData[MAX_CSV_ROWS][MAX_CSV_COLS];
     int csvRows, csvCols, csvN;
+    traceBegin("Read CSV");
     readCSV(data->csvFilePath, csvData, &csvRows, &csvCols);
+    traceEnd("Read CSV");
 
+    traceBegin("Parse Weights");
     csvN = (csvRows <= csvCols) ? csvRows : csvCols;
     int adj[csvN-1][csvN-1];
     for (int i = 1; i < csvN; i++)
         for (int j = 1; j < csvN; j++)
             adj[i-1][j-1] = strtol(csvData[i][j], NULL, 10);
+    traceEnd("Parse Weights");
 
     *(data->pointCount) = csvN-1;
+    traceBegin("Build Graph");
     editGraph(data->theGraph, *(data->pointCount), csvData[0]+1, adj);
+    traceEnd("Build Graph");
+    traceBegin("Place Points");
     createPointPolygon(data->points, *(data->pointCount), data->polygonCenter, data->polygonRadius);
+    traceEnd("Place Points");
 
     TextCopy(data->bfsSrcLabel, data->theGraph->labels[0]);
     TextCopy(data->dfsSrcLabel, data->theGraph->labels[0]);
@@ -47,16 +110,21 @@ void *bfsThread(void *arg)
 {
     bfsThreadData *data = (bfsThreadData *)arg;
     *(data->status) = IN_PROGRESS;
+    traceThreadName("BFS");
+
+    // Pin the latest Graph, edits made meanwhile go to newer Versions
+    GraphVersion *version = graphStorePin(data->graphs);
+    Graph *theGraph = &version->graph;
 
     // Search for Source and Destination Vertices
     *(data->current) = -1;
     *(data->src) = -1;
     *(data->dest) = -1;
-    for (int i = 0; i < data->theGraph->n; i++)
+    for (int i = 0; i < theGraph->n; i++)
     {
-        if (strcmp(data->theGraph->labels[i], data->srcLabel) == 0)
+        if (strcmp(theGraph->labels[i], data->srcLabel) == 0)
             *(data->src) = i;
-        if (strcmp(data->theGraph->labels[i], data->destLabel) == 0)
+        if (strcmp(theGraph->labels[i], data->destLabel) == 0)
             *(data->dest) = i;
         if (*(data->src) != -1 && *(data->dest) != -1)
             break;
@@ -65,47 +133,66 @@ void *bfsThread(void *arg)
     // If Source or Destination Vertex not Found
     if (*(data->src) == -1 || *(data->dest) == -1)
     {
+        graphStoreUnpin(version);
+        *(data->animationActive) = false;
         *(data->status) = COMPLETED;
+        return NULL;
+    }
+
+    // If Destination cannot be reached from Source
+    if (data->reachability != NULL && !reachable(data->reachability, theGraph, *(data->src), *(data->dest)))
+    {
+        graphStoreUnpin(version);
         *(data->animationActive) = false;
+        *(data->status) = COMPLETED;
         return NULL;
     }
 
     // Initialize all Variables
-    for (int i = 0; i < data->theGraph->n; i++)
+    for (int i = 0; i < theGraph->n; i++)
         data->visited[i] = false;
     *(data->qFront) = 0;
     *(data->qRear) = 0;
     *(data->current) = *(data->src);
 
+    _publishBfs(data, theGraph);
     delay(2);
 
     // Algorithm Starts
+    traceBegin("BFS Search");
     data->visited[*(data->current)] = true;
     data->queue[(*(data->qRear))++] = *(data->current);
 
+    _publishBfs(data, theGraph);
     delay(1);
 
     while (*(data->qFront) < *(data->qRear)) {
+        traceBegin("Expand Vertex");
         *(data->current) = data->queue[(*(data->qFront))++];
         *(data->childrenTop) = 0;
 
-        for (int v = 0; v < data->theGraph->n; v++)
-            if (data->theGraph->adj[*(data->current)][v] && !data->visited[v]) {
+        for (int v = 0; v < theGraph->n; v++)
+            if (theGraph->adj[*(data->current)][v] && !data->visited[v]) {
                 data->visited[v] = true;
                 if (v == *(data->dest))
                     break;
                 data->queue[(*(data->qRear))++] = v;
                 data->children[(*(data->childrenTop))++] = v;
             }
+        traceEnd("Expand Vertex");
 
+        _publishBfs(data, theGraph);
         delay(1);
     }
+    traceEnd("BFS Search");
     // Algorithm Ends
 
+    _publishBfs(data, theGraph);
     delay(2);
 
-    *(data->status) = COMPLETED;
+    graphStoreUnpin(version);
     *(data->animationActive) = false;
+    *(data->status) = COMPLETED;
     return NULL;
 }
 //----------------------------------------------------------------------------------
@@ -116,16 +203,21 @@ void *dfsThread(void *arg)
 {
     dfsThreadData *data = (dfsThreadData *)arg;
     *(data->status) = IN_PROGRESS;
+    traceThreadName("DFS");
+
+    // Pin the latest Graph, edits made meanwhile go to newer Versions
+    GraphVersion *version = graphStorePin(data->graphs);
+    Graph *theGraph = &version->graph;
 
     // Search for Source and Destination Vertices
     *(data->current) = -1;
     *(data->src) = -1;
     *(data->dest) = -1;
-    for (int i = 0; i < data->theGraph->n; i++)
+    for (int i = 0; i < theGraph->n; i++)
     {
-        if (strcmp(data->theGraph->labels[i], data->srcLabel) == 0)
+        if (strcmp(theGraph->labels[i], data->srcLabel) == 0)
             *(data->src) = i;
-        if (strcmp(data->theGraph->labels[i], data->destLabel) == 0)
+        if (strcmp(theGraph->labels[i], data->destLabel) == 0)
             *(data->dest) = i;
         if (*(data->src) != -1 && *(data->dest) != -1)
             break;
@@ -134,31 +226,45 @@ void *dfsThread(void *arg)
     // If Source or Destination Vertex not Found
     if (*(data->src) == -1 || *(data->dest) == -1)
     {
+        graphStoreUnpin(version);
+        *(data->animationActive) = false;
         *(data->status) = COMPLETED;
+        return NULL;
+    }
+
+    // If Destination cannot be reached from Source
+    if (data->reachability != NULL && !reachable(data->reachability, theGraph, *(data->src), *(data->dest)))
+    {
+        graphStoreUnpin(version);
         *(data->animationActive) = false;
+        *(data->status) = COMPLETED;
         return NULL;
     }
 
     // Initialize all Variables
-    for (int i = 0; i < data->theGraph->n; i++)
+    for (int i = 0; i < theGraph->n; i++)
         data->visited[i] = false;
     *(data->sTop) = 0;
 
+    _publishDfs(data, theGraph);
     delay(2);
 
     // Algorithm Starts
+    traceBegin("DFS Search");
     data->visited[*(data->src)] = true;
     data->stack[(*(data->sTop))++] = *(data->src);
 
+    _publishDfs(data, theGraph);
     delay(1);
 
     while (*(data->sTop) > 0) {
+        traceBegin("Expand Vertex");
         *(data->current) = data->stack[--(*(data->sTop))];
         *(data->childrenTop) = 0;
 
-        for (int v = 0; v < data->theGraph->n; v++)
+        for (int v = 0; v < theGraph->n; v++)
         {
-            if (data->theGraph->adj[*(data->current)][v] && !data->visited[v]) {
+            if (theGraph->adj[*(data->current)][v] && !data->visited[v]) {
                 data->visited[v] = true;
                 if (v == *(data->dest))
                     break;
@@ -166,14 +272,19 @@ void *dfsThread(void *arg)
                 data->children[(*(data->childrenTop))++] = v;
             }
         }
+        traceEnd("Expand Vertex");
+        _publishDfs(data, theGraph);
         delay(1);
     }
+    traceEnd("DFS Search");
     // Algorithm Ends
 
+    _publishDfs(data, theGraph);
     delay(2);
 
-    *(data->status) = COMPLETED;
+    graphStoreUnpin(version);
     *(data->animationActive) = false;
+    *(data->status) = COMPLETED;
     return NULL;
 }
 //----------------------------------------------------------------------------------
@@ -184,16 +295,21 @@ void *dijkstraThread(void *arg)
 {
     dijkstraThreadData *data = (dijkstraThreadData *)arg;
     *(data->status) = IN_PROGRESS;
+    traceThreadName("Dijkstra");
+
+    // Pin the latest Graph, edits made meanwhile go to newer Versions
+    GraphVersion *version = graphStorePin(data->graphs);
+    Graph *theGraph = &version->graph;
 
     // Search for Source and Destination Vertices
     *(data->current) = -1;
     *(data->src) = -1;
     *(data->dest) = -1;
-    for (int i = 0; i < data->theGraph->n; i++)
+    for (int i = 0; i < theGraph->n; i++)
     {
-        if (strcmp(data->theGraph->labels[i], data->srcLabel) == 0)
+        if (strcmp(theGraph->labels[i], data->srcLabel) == 0)
             *(data->src) = i;
-        if (strcmp(data->theGraph->labels[i], data->destLabel) == 0)
+        if (strcmp(theGraph->labels[i], data->destLabel) == 0)
             *(data->dest) = i;
         if (*(data->src) != -1 && *(data->dest) != -1)
             break;
@@ -202,8 +318,18 @@ void *dijkstraThread(void *arg)
     // If Source or Destination Vertex not Found
     if (*(data->src) == -1 || *(data->dest) == -1)
     {
+        graphStoreUnpin(version);
+        *(data->animationActive) = false;
         *(data->status) = COMPLETED;
+        return NULL;
+    }
+
+    // If Destination cannot be reached from Source
+    if (data->reachability != NULL && !reachable(data->reachability, theGraph, *(data->src), *(data->dest)))
+    {
+        graphStoreUnpin(version);
         *(data->animationActive) = false;
+        *(data->status) = COMPLETED;
         return NULL;
     }
 
@@ -214,7 +340,7 @@ void *dijkstraThread(void *arg)
     data->distance[*(data->src)] = 0;
     data->previous[*(data->src)] = -1;
     pQueueInsert(data->pQueue, *(data->src), 0);
-    for (int i = 0; i < data->theGraph->n; i++)
+    for (int i = 0; i < theGraph->n; i++)
     {
         data->visited[i] = false;
         if (i != *(data->src))
@@ -226,20 +352,23 @@ void *dijkstraThread(void *arg)
     }
     int distCheck;
 
+    _publishDijkstra(data, theGraph);
     delay(2);
 
     // Algorithm Starts
     // Search all Vertices for Shortest Path
+    traceBegin("Dijkstra Search");
     while (data->pQueue->filled > 0)
     {
+        traceBegin("Relax Edges");
         *(data->current) = pQueueExtractMin(data->pQueue);
         data->visited[*(data->current)] = true;
         *(data->childrenTop) = 0;
 
-        for (int v = 0; v < data->theGraph->n; v++)
+        for (int v = 0; v < theGraph->n; v++)
         {
-            distCheck = data->distance[*(data->current)] + data->theGraph->adj[*(data->current)][v];
-            if (!data->visited[v] && data->theGraph->adj[*(data->current)][v] && data->distance[v] > distCheck)
+            distCheck = data->distance[*(data->current)] + theGraph->adj[*(data->current)][v];
+            if (!data->visited[v] && theGraph->adj[*(data->current)][v] && data->distance[v] > distCheck)
             {
                 data->distance[v] = distCheck;
                 data->previous[v] = *(data->current);
@@ -247,13 +376,18 @@ void *dijkstraThread(void *arg)
                 pQueueDecreaseKey(data->pQueue, v, data->distance[v]);
             }
         }
+        traceEnd("Relax Edges");
 
+        _publishDijkstra(data, theGraph);
         delay(1);
     }
+    traceEnd("Dijkstra Search");
 
+    _publishDijkstra(data, theGraph);
     delay(1);
 
     // Find Shortest Path
+    traceInstant("Trace Path");
     *(data->current) = *(data->dest);
     data->path[--(*(data->pathHead))] = *(data->dest);
     while (*(data->current) != *(data->src))
@@ -266,14 +400,57 @@ void *dijkstraThread(void *arg)
     }
 
     if (*(data->current) == *(data->src))
+    {
+        _publishDijkstra(data, theGraph);
         delay(3);
+    }
     // Algorithm Ends
 
+    _publishDijkstra(data, theGraph);
     delay(2);
     pQueueDeinit(data->pQueue);
 
-    *(data->status) = COMPLETED;
+    graphStoreUnpin(version);
     *(data->animationActive) = false;
+    *(data->status) = COMPLETED;
+    return NULL;
+}
+//----------------------------------------------------------------------------------
+
+// Thread Function to run a Force-Directed Layout
+// Every Iteration is published to the Render Thread, which copies it into the Points so the Layout animates
+//----------------------------------------------------------------------------------
+void *layoutThread(void *arg)
+{
+    layoutThreadData *data = (layoutThreadData *)arg;
+    *(data->status) = IN_PROGRESS;
+    traceThreadName("Force Layout");
+
+    int threadCount = parallelThreadCount();
+    bool converged = false;
+    while (*(data->layoutActive) && !converged)
+    {
+        // Hold the Vertex the Render Thread is dragging where it was dropped
+        pthread_mutex_lock(data->lock);
+        data->layout->pinned = (*(data->pinned) < data->layout->n) ? *(data->pinned) : -1;
+        if (data->layout->pinned != -1)
+            data->layout->positions[data->layout->pinned] = *(data->pinnedPosition);
+        pthread_mutex_unlock(data->lock);
+
+        traceBegin("Layout Step");
+        converged = forceLayoutStep(data->layout, threadCount);
+        traceEnd("Layout Step");
+
+        pthread_mutex_lock(data->lock);
+        memcpy(data->published, data->layout->positions, data->layout->n * sizeof(Vector2));
+        *(data->publishedIterations) = data->layout->iterations;
+        *(data->publishedTemperature) = data->layout->temperature;
+        pthread_mutex_unlock(data->lock);
+
+        usleep(LAYOUT_STEP_MICROSECONDS);
+    }
+
+    *(data->status) = COMPLETED;
     return NULL;
 }
 //----------------------------------------------------------------------------------
@@ -1,11 +1,18 @@
 #ifndef _THREADING_H_
 #define _THREADING_H_
 
+#include <pthread.h>
+#include <stdatomic.h>
+
 #include "raylib.h"
 
 #include "csv.h"
+#include "forceLayout.h"
 #include "graph.h"
+#include "graphStore.h"
 #include "priorityQueue.h"
+#include "reachability.h"
+#include "snapshot.h"
 
 // Thread Status
 typedef enum threadStatus {
@@ -14,12 +21,15 @@ typedef enum threadStatus {
     COMPLETED        // Thread has completed execution
 } ThreadStatus;
 
+// Thread Status shared between the Render Thread and a Worker
+typedef _Atomic ThreadStatus AtomicThreadStatus;
+
 //------------------------------------------------------------------------------------
 // Thread Data Structures
 
 typedef struct csvThreadData
 {
-    ThreadStatus *status;    // Thread Status
+    AtomicThreadStatus *status; // Thread Status
     char *csvFilePath;       // CSV File Path
     Vector2 *points;         // Points Array
     int *pointCount;         // Point Count
@@ -36,8 +46,8 @@ typedef struct csvThreadData
 
 typedef struct bfsThreadData
 {
-    ThreadStatus *status;  // Thread Status
-    Graph *theGraph;       // Graph
+    AtomicThreadStatus *status; // Thread Status
+    GraphStore *graphs;    // Published Graph Versions, the latest pinned for the whole Run
     char *srcLabel;        // Source Label
     char *destLabel;       // Destination Label
     int *current;          // Current Vertex
@@ -49,13 +59,15 @@ typedef struct bfsThreadData
     int *queue;            // BFS Queue
     int *qFront;           // Queue Front Index
     int *qRear;            // Queue Rear Index
-    bool *animationActive; // Animation Active Flag
+    atomic_bool *animationActive; // Animation Active Flag
+    ReachabilityIndex *reachability; // Reachability Index for Unreachable Destinations (optional)
+    SnapshotBuffer *snapshots; // Published State of each Step, the only Part the Render Thread reads
 } bfsThreadData;
 
 typedef struct dfsThreadData
 {
-    ThreadStatus *status;  // Thread Status
-    Graph *theGraph;       // Graph
+    AtomicThreadStatus *status; // Thread Status
+    GraphStore *graphs;    // Published Graph Versions, the latest pinned for the whole Run
     char *srcLabel;        // Source Label
     char *destLabel;       // Destination Label
     int *current;          // Current Vertex
@@ -66,13 +78,15 @@ typedef struct dfsThreadData
     bool *visited;         // Visited Array
     int *stack;            // DFS Stack
     int *sTop;             // Stack Top Index
-    bool *animationActive; // Animation Active Flag
+    atomic_bool *animationActive; // Animation Active Flag
+    ReachabilityIndex *reachability; // Reachability Index for Unreachable Destinations (optional)
+    SnapshotBuffer *snapshots; // Published State of each Step, the only Part the Render Thread reads
 } dfsThreadData;
 
 typedef struct dijkstraThreadData
 {
-    ThreadStatus *status;  // Thread Status
-    Graph *theGraph;       // Graph
+    AtomicThreadStatus *status; // Thread Status
+    GraphStore *graphs;    // Published Graph Versions, the latest pinned for the whole Run
     char *srcLabel;        // Source Label
     char *destLabel;       // Destination Label
     int *current;          // Current Vertex
@@ -86,12 +100,28 @@ typedef struct dijkstraThreadData
     bool *visited;         // Visited Array
     int *path;             // Path Array
     int *pathHead;         // Path Head Index
-    bool *animationActive; // Animation Active Flag
+    atomic_bool *animationActive; // Animation Active Flag
+    ReachabilityIndex *reachability; // Reachability Index for Unreachable Destinations (optional)
+    SnapshotBuffer *snapshots; // Published State of each Step, the only Part the Render Thread reads
 } dijkstraThreadData;
 
+typedef struct layoutThreadData
+{
+    AtomicThreadStatus *status; // Thread Status
+    ForceLayout *layout;      // Layout being run
+    pthread_mutex_t *lock;    // Lock over the published Positions and the Pin
+    Vector2 *published;       // Positions after the latest Iteration
+    int *publishedIterations; // Iterations published so far
+    float *publishedTemperature; // Step Size after the latest Iteration
+    int *pinned;              // Vertex the Render Thread holds in Place (-1 if none)
+    Vector2 *pinnedPosition;  // Where the pinned Vertex is held
+    atomic_bool *layoutActive; // Layout Active Flag, cleared by the Render Thread to stop early
+} layoutThreadData;
+
 void *csvThread(void *arg);
 void *bfsThread(void *arg);
 void *dfsThread(void *arg);
 void *dijkstraThread(void *arg);
+void *layoutThread(void *arg);
 
 #endif
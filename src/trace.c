@@ -0,0 +1,196 @@
+#include "trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "parallel.h"
+
+static bool _active = false;
+static double _start = 0.0;
+static int _capture = 0;
+static int _bufferCount = 0;
+static TraceBuffer *_buffers[TRACE_MAX_THREADS];
+
+// Buffer of the calling Thread and the Capture it was claimed in
+static __thread TraceBuffer *_threadBuffer = NULL;
+static __thread int _threadCapture = -1;
+static __thread const char *_pendingName = NULL;
+
+// Claim a Buffer for the calling Thread in the current Capture, returns NULL once all are taken
+static TraceBuffer *_buffer(void)
+{
+    int capture = __atomic_load_n(&_capture, __ATOMIC_ACQUIRE);
+    if (_threadCapture == capture)
+        return _threadBuffer;
+
+    _threadCapture = capture;
+    _threadBuffer = NULL;
+    int slot = __atomic_fetch_add(&_bufferCount, 1, __ATOMIC_ACQ_REL);
+    if (slot >= TRACE_MAX_THREADS)
+        return NULL;
+
+    TraceBuffer *buffer = _buffers[slot];
+    if (buffer == NULL && (buffer = (TraceBuffer *)malloc(sizeof(TraceBuffer))) == NULL)
+        return NULL;
+    buffer->tid = slot + 1;
+    buffer->threadName = _pendingName;
+    buffer->count = 0;
+    buffer->dropped = 0;
+    __atomic_store_n(&_buffers[slot], buffer, __ATOMIC_RELEASE);
+    return _threadBuffer = buffer;
+}
+
+// Append an Event to the calling Thread's Buffer
+static void _record(const char *name, char phase)
+{
+    if (!__atomic_load_n(&_active, __ATOMIC_ACQUIRE))
+        return;
+    TraceBuffer *buffer = _buffer();
+    if (buffer == NULL)
+        return;
+
+    int count = buffer->count;
+    if (count == TRACE_BUFFER_EVENTS)
+    {
+        __atomic_store_n(&buffer->dropped, buffer->dropped + 1, __ATOMIC_RELAXED);
+        return;
+    }
+    buffer->events[count] = (TraceEvent){name, phase, (parallelTime() - _start) * 1e6};
+    __atomic_store_n(&buffer->count, count + 1, __ATOMIC_RELEASE);
+}
+
+// Start a new Capture, discarding the Events of the last one
+// Must not be called while another Capture is being dumped
+void traceStart(void)
+{
+    if (_active)
+        return;
+    int slots = (_bufferCount < TRACE_MAX_THREADS) ? _bufferCount : TRACE_MAX_THREADS;
+    for (int slot = 0; slot < slots; slot++)
+        if (_buffers[slot] != NULL)
+            _buffers[slot]->count = _buffers[slot]->dropped = 0;
+    _bufferCount = 0;
+    _start = parallelTime();
+    __atomic_add_fetch(&_capture, 1, __ATOMIC_RELEASE);
+    __atomic_store_n(&_active, true, __ATOMIC_RELEASE);
+}
+
+// Stop recording, the Events stay until the next Capture starts
+void traceStop(void)
+{
+    __atomic_store_n(&_active, false, __ATOMIC_RELEASE);
+}
+
+// Check if a Capture is running
+bool traceActive(void)
+{
+    return __atomic_load_n(&_active, __ATOMIC_ACQUIRE);
+}
+
+// Name the calling Thread, kept for later Captures too
+void traceThreadName(const char *name)
+{
+    _pendingName = name;
+    if (!traceActive())
+        return;
+    TraceBuffer *buffer = _buffer();
+    if (buffer != NULL)
+        buffer->threadName = name;
+}
+
+// Open a Span on the calling Thread
+void traceBegin(const char *name)
+{
+    _record(name, 'B');
+}
+
+// Close the innermost open Span on the calling Thread
+void traceEnd(const char *name)
+{
+    _record(name, 'E');
+}
+
+// Mark a single Point in Time on the calling Thread
+void traceInstant(const char *name)
+{
+    _record(name, 'i');
+}
+
+// Number of Events lost to full Buffers in the current Capture
+int traceDropped(void)
+{
+    int dropped = 0, slots = __atomic_load_n(&_bufferCount, __ATOMIC_ACQUIRE);
+    if (slots > TRACE_MAX_THREADS)
+        slots = TRACE_MAX_THREADS;
+    for (int slot = 0; slot < slots; slot++)
+    {
+        TraceBuffer *buffer = __atomic_load_n(&_buffers[slot], __ATOMIC_ACQUIRE);
+        if (buffer != NULL)
+            dropped += __atomic_load_n(&buffer->dropped, __ATOMIC_RELAXED);
+    }
+    return dropped;
+}
+
+// Write the current Capture as Chrome Trace Event JSON, loadable in chrome://tracing or Perfetto
+// Threads may keep recording meanwhile, only the Events published when their Buffer is reached are written
+int traceDump(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "Error: Could not open Trace File %s\n", path);
+        return -1;
+    }
+
+    int slots = __atomic_load_n(&_bufferCount, __ATOMIC_ACQUIRE);
+    if (slots > TRACE_MAX_THREADS)
+        slots = TRACE_MAX_THREADS;
+
+    bool first = true;
+    fprintf(file, "{\"traceEvents\":[");
+    for (int slot = 0; slot < slots; slot++)
+    {
+        TraceBuffer *buffer = __atomic_load_n(&_buffers[slot], __ATOMIC_ACQUIRE);
+        if (buffer == NULL)
+            continue;
+
+        if (buffer->threadName != NULL)
+        {
+            fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                    first ? "" : ",", buffer->tid, buffer->threadName);
+            first = false;
+        }
+
+        int count = __atomic_load_n(&buffer->count, __ATOMIC_ACQUIRE);
+        for (int e = 0; e < count; e++)
+        {
+            TraceEvent *event = &buffer->events[e];
+            fprintf(file, "%s\n{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%d%s}",
+                    first ? "" : ",", event->name, event->phase, event->timestamp, buffer->tid,
+                    (event->phase == 'i') ? ",\"s\":\"t\"" : "");
+            first = false;
+        }
+    }
+    fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    if (fclose(file) != 0)
+    {
+        fprintf(stderr, "Error: Could not write Trace File %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+// Free the Buffers of every Thread, ending any Capture
+// Must only be called once no other Thread can record, a later Capture allocates new Buffers
+void traceDeinit(void)
+{
+    traceStop();
+    for (int slot = 0; slot < TRACE_MAX_THREADS; slot++)
+    {
+        free(_buffers[slot]);
+        _buffers[slot] = NULL;
+    }
+    _bufferCount = 0;
+    __atomic_add_fetch(&_capture, 1, __ATOMIC_RELEASE);
+}
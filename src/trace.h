@@ -0,0 +1,37 @@
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+#include <stdbool.h>
+
+#define TRACE_MAX_THREADS 64
+#define TRACE_BUFFER_EVENTS 16384
+
+// Event recorded by the Tracer, in the Phases of the Chrome Trace Event Format
+typedef struct traceEvent_t {
+    const char *name;                     // Event Name (must outlive the Capture, e.g. a String Literal)
+    char phase;                           // 'B' for Begin, 'E' for End, 'i' for Instant
+    double timestamp;                     // Microseconds since the Capture started
+} TraceEvent;
+
+// Events of one Thread, appended only by that Thread so no Lock is needed
+// The Count is published with Release Order, so a Reader sees every Event below it complete
+typedef struct traceBuffer_t {
+    int tid;                              // Trace Thread ID (Index of the Buffer)
+    const char *threadName;               // Name shown for the Thread (NULL if unnamed)
+    int count;                            // Events recorded
+    int dropped;                          // Events lost to a full Buffer
+    TraceEvent events[TRACE_BUFFER_EVENTS]; // Recorded Events, oldest first
+} TraceBuffer;
+
+void traceStart(void);
+void traceStop(void);
+bool traceActive(void);
+void traceThreadName(const char *name);
+void traceBegin(const char *name);
+void traceEnd(const char *name);
+void traceInstant(const char *name);
+int traceDropped(void);
+int traceDump(const char *path);
+void traceDeinit(void);
+
+#endif
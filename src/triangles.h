@@ -0,0 +1,19 @@
+#ifndef _TRIANGLES_H_
+#define _TRIANGLES_H_
+
+#include "graph.h"
+
+// Triangle Counts and Clustering Coefficients, Edges taken as undirected
+typedef struct triangleResult_t {
+    unsigned int version;                 // Graph Version the Counts were computed for (0 if never computed)
+    int n;                                // Number of Vertices
+    long long triangles;                  // Triangles in the whole Graph
+    long long vertexTriangles[MAX_VERTICES]; // Triangles through each Vertex
+    float clustering[MAX_VERTICES];       // Local Clustering Coefficient of each Vertex
+    float averageClustering;              // Mean Local Clustering Coefficient
+} TriangleResult;
+
+void triangleResultInit(TriangleResult *result);
+long long countTriangles(Graph *g, int threadCount, TriangleResult *result);
+
+#endif
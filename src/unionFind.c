@@ -0,0 +1,61 @@
+#include "unionFind.h"
+
+// Initialize every Vertex as its own Set
+void unionFindInit(int parent[], int n)
+{
+    for (int i = 0; i < n; i++)
+        parent[i] = i;
+}
+
+// Find the Root of the Set containing v, halving the Path on the way
+int unionFindFind(int parent[], int v)
+{
+    while (1) {
+        int p = __atomic_load_n(&parent[v], __ATOMIC_ACQUIRE);
+        if (p == v)
+            return v;
+
+        int gp = __atomic_load_n(&parent[p], __ATOMIC_ACQUIRE);
+        if (p != gp)
+            __atomic_compare_exchange_n(&parent[v], &p, gp, false, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+        v = gp;
+    }
+}
+
+// Merge the Sets containing u and v, returns true if they were different
+// The larger Root is always hooked under the smaller one, so concurrent Unions cannot form a Cycle
+bool unionFindUnion(int parent[], int u, int v)
+{
+    while (1) {
+        u = unionFindFind(parent, u);
+        v = unionFindFind(parent, v);
+        if (u == v)
+            return false;
+
+        if (u < v) {
+            int tmp = u;
+            u = v;
+            v = tmp;
+        }
+
+        int expected = u;
+        if (__atomic_compare_exchange_n(&parent[u], &expected, v, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+            return true;
+    }
+}
+
+// Label every Vertex with a Set ID from 0 to count - 1 in order of first appearance, returns count
+// Only valid once all Unions have finished
+int unionFindLabel(int parent[], int n, int label[])
+{
+    int count = 0;
+    for (int i = 0; i < n; i++)
+    {
+        int root = unionFindFind(parent, i);
+        if (root == i)
+            label[i] = count++;
+        else
+            label[i] = label[root];
+    }
+    return count;
+}
@@ -0,0 +1,14 @@
+#ifndef _UNION_FIND_H_
+#define _UNION_FIND_H_
+
+#include <stdbool.h>
+
+// Lock-Free Disjoint Set over Vertices 0 to n - 1
+// Safe to call unionFindFind and unionFindUnion from several Threads at once
+
+void unionFindInit(int parent[], int n);
+int unionFindFind(int parent[], int v);
+bool unionFindUnion(int parent[], int u, int v);
+int unionFindLabel(int parent[], int n, int label[]);
+
+#endif
@@ -60,5 +60,6 @@ void changeWeights(Graph *graph) {
                 }
             }
         }
+    graphTouch(graph);
 }
 //----------------------------------------------------------------------------------
@@ -0,0 +1,91 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+
+#include "../src/betweenness.h"
+
+Graph g;
+BetweennessResult result, parallelResult;
+
+// Betweenness - Test Case 1
+int test1()
+{
+    // Undirected Path 0 - 1 - 2 - 3
+    graphInit(&g, 4, NULL);
+    for (int i = 0; i < 3; i++)
+    {
+        g.adj[i][i + 1] = 1;
+        g.adj[i + 1][i] = 1;
+    }
+    graphTouch(&g);
+
+    betweennessInit(&result);
+    assert(betweennessCentrality(&g, false, 0, 0, 1, &result) == 4);
+
+    assert(fabs(result.centrality[0]) < 1e-9);
+    assert(fabs(result.centrality[1] - 4.0) < 1e-9);
+    assert(fabs(result.centrality[2] - 4.0) < 1e-9);
+    assert(fabs(result.centrality[3]) < 1e-9);
+    assert(fabs(result.maxCentrality - 4.0) < 1e-9);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// Betweenness - Test Case 2
+int test2()
+{
+    // Two equal Paths from 0 to 3 split the Dependency, the heavy Edge is never used
+    graphInit(&g, 4, NULL);
+    editEdge(&g, "0", "1", 1);
+    editEdge(&g, "1", "3", 1);
+    editEdge(&g, "0", "2", 1);
+    editEdge(&g, "2", "3", 1);
+    editEdge(&g, "0", "3", 5);
+
+    betweennessCentrality(&g, true, 0, 0, 1, &result);
+    assert(fabs(result.centrality[1] - 0.5) < 1e-9);
+    assert(fabs(result.centrality[2] - 0.5) < 1e-9);
+
+    betweennessCentrality(&g, false, 0, 0, 1, &result);
+    assert(fabs(result.centrality[1]) < 1e-9);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// Betweenness - Test Case 3
+int test3()
+{
+    srand(5);
+    graphInit(&g, MAX_VERTICES, NULL);
+    for (int i = 0; i < g.n; i++)
+        for (int j = 0; j < g.n; j++)
+            if (i != j && rand() % 12 == 0)
+                g.adj[i][j] = 1 + rand() % 5;
+    graphTouch(&g);
+
+    betweennessCentrality(&g, true, 0, 0, 1, &result);
+    betweennessCentrality(&g, true, 0, 0, 4, &parallelResult);
+    for (int i = 0; i < g.n; i++)
+        assert(fabs(result.centrality[i] - parallelResult.centrality[i]) < 1e-6);
+
+    // Sampling every Vertex is exact, fewer Sources give an Estimate
+    betweennessCentrality(&g, true, g.n, 9, 4, &parallelResult);
+    for (int i = 0; i < g.n; i++)
+        assert(fabs(result.centrality[i] - parallelResult.centrality[i]) < 1e-6);
+    assert(betweennessCentrality(&g, true, 16, 9, 4, &parallelResult) == 16);
+    assert(parallelResult.sources == 16);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+int main(void)
+{
+    printf("Betweenness - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Betweenness - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    printf("Betweenness - Test 3 %s\n", test3() ? "PASSED" : "FAILED");
+    return 0;
+}
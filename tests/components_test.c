@@ -0,0 +1,83 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "../src/components.h"
+#include "../src/parallel.h"
+
+Graph g;
+
+// Check that two Component Arrays describe the same Partition
+int samePartition(int n, int a[], int b[])
+{
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            if ((a[i] == a[j]) != (b[i] == b[j]))
+                return 0;
+    return 1;
+}
+
+// Components - Test Case 1
+int test1()
+{
+    char *labels[] = {"a", "b", "c", "d", "e", "f", "g", "h"};
+    graphInit(&g, 8, labels);
+
+    addEdge(&g, "a", "b");
+    addEdge(&g, "b", "c");
+    addEdge(&g, "c", "a");
+    addEdge(&g, "c", "d");
+    addEdge(&g, "d", "e");
+    addEdge(&g, "e", "d");
+    addEdge(&g, "f", "g");
+
+    int tarjan[MAX_VERTICES], parallel[MAX_VERTICES], weak[MAX_VERTICES];
+
+    assert(stronglyConnectedComponents(&g, tarjan) == 5);
+    assert(tarjan[0] == tarjan[1] && tarjan[1] == tarjan[2]);
+    assert(tarjan[3] == tarjan[4]);
+    assert(tarjan[0] != tarjan[3]);
+    // Reverse Topological Order: {d, e} is finished before {a, b, c}
+    assert(tarjan[3] < tarjan[0]);
+
+    assert(parallelStronglyConnectedComponents(&g, parallel, 4) == 5);
+    assert(samePartition(g.n, tarjan, parallel));
+
+    assert(weaklyConnectedComponents(&g, weak, 4) == 3);
+    assert(weak[0] == 0 && weak[4] == 0);
+    assert(weak[5] == 1 && weak[6] == 1);
+    assert(weak[7] == 2);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// Components - Test Case 2
+int test2()
+{
+    srand(42);
+    for (int round = 0; round < 50; round++)
+    {
+        graphInit(&g, MAX_VERTICES, NULL);
+        for (int i = 0; i < g.n; i++)
+            for (int j = 0; j < g.n; j++)
+                if (i != j && rand() % 64 == 0)
+                    g.adj[i][j] = 1;
+        graphTouch(&g);
+
+        int tarjan[MAX_VERTICES], parallel[MAX_VERTICES];
+        int count = stronglyConnectedComponents(&g, tarjan);
+        assert(parallelStronglyConnectedComponents(&g, parallel, parallelThreadCount() + 1) == count);
+        assert(samePartition(g.n, tarjan, parallel));
+
+        graphDeinit(&g);
+    }
+    return 1;
+}
+
+int main(void)
+{
+    printf("Components - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Components - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "../src/compressedGraph.h"
+#include "../src/parallel.h"
+
+Graph g;
+CompressedGraph cg;
+
+// Print the Memory used by the Matrix, a plain CSR Layout and the packed Lists, and Search Times from every Source
+void compressionReport(Graph *g, CompressedGraph *cg, int rounds)
+{
+    int dist[MAX_VERTICES], prev[MAX_VERTICES], order[MAX_VERTICES];
+    volatile int sink = 0;
+
+    size_t matrixBytes = (size_t)g->n * g->n * sizeof(int);
+    size_t csrBytes = (size_t)(g->n + 1) * sizeof(int) + (size_t)cg->edges * 2 * sizeof(int);
+    printf("Adjacency: %d Edges, Matrix %zu Bytes, CSR %zu Bytes, Compressed %zu Bytes (%.2fx smaller than CSR)\n",
+        cg->edges, matrixBytes, csrBytes, compressedGraphBytes(cg), (double)csrBytes / compressedGraphBytes(cg));
+
+    double start = parallelTime();
+    for (int r = 0; r < rounds; r++)
+        for (int u = 0; u < g->n; u++)
+            sink += bfsDistances(g, u, dist, order);
+    double matrixBfs = parallelTime() - start;
+
+    start = parallelTime();
+    for (int r = 0; r < rounds; r++)
+        for (int u = 0; u < cg->n; u++)
+            sink += compressedBfsDistances(cg, u, dist, order);
+    double compressedBfs = parallelTime() - start;
+
+    start = parallelTime();
+    for (int r = 0; r < rounds; r++)
+        for (int u = 0; u < g->n; u++)
+            sink += djkDistances(g, u, dist, prev, order);
+    double matrixDjk = parallelTime() - start;
+
+    start = parallelTime();
+    for (int r = 0; r < rounds; r++)
+        for (int u = 0; u < cg->n; u++)
+            sink += compressedDjkDistances(cg, u, dist, prev, order);
+    double compressedDjk = parallelTime() - start;
+
+    printf("  BFS: Matrix %.3f ms, Compressed %.3f ms\n", matrixBfs * 1000.0, compressedBfs * 1000.0);
+    printf("  Dijkstra: Matrix %.3f ms, Compressed %.3f ms\n", matrixDjk * 1000.0, compressedDjk * 1000.0);
+}
+
+// Compressed Graph - Test Case 1
+int test1()
+{
+    graphInit(&g, MAX_VERTICES, NULL);
+    g.adj[0][1] = 5;
+    g.adj[0][63] = 100000;
+    g.adj[2][0] = -3;
+    g.adj[5][5] = 1;
+    graphTouch(&g);
+
+    compressedGraphInit(&cg);
+    assert(compressGraph(&g, &cg) > 0);
+    assert(cg.edges == 4 && cg.version == g.version);
+
+    NeighbourIterator it;
+    neighbourBegin(&cg, 0, &it);
+    assert(neighbourNext(&it) && it.vertex == 1 && it.weight == 5);
+    assert(neighbourNext(&it) && it.vertex == 63 && it.weight == 100000);
+    assert(!neighbourNext(&it));
+    neighbourBegin(&cg, 2, &it);
+    assert(neighbourNext(&it) && it.vertex == 0 && it.weight == -3);
+    assert(!neighbourNext(&it));
+    neighbourBegin(&cg, 3, &it);
+    assert(!neighbourNext(&it));
+    neighbourBegin(&cg, 5, &it);
+    assert(neighbourNext(&it) && it.vertex == 5 && it.weight == 1);
+
+    compressedGraphDeinit(&cg);
+    graphDeinit(&g);
+    return 1;
+}
+
+// Compressed Graph - Test Case 2
+int test2()
+{
+    int dist[MAX_VERTICES], prev[MAX_VERTICES], order[MAX_VERTICES];
+    int expectedDist[MAX_VERTICES], expectedPrev[MAX_VERTICES], expectedOrder[MAX_VERTICES];
+
+    srand(40);
+    for (int round = 0; round < 30; round++)
+    {
+        graphInit(&g, MAX_VERTICES, NULL);
+        for (int i = 0; i < g.n; i++)
+            for (int j = 0; j < g.n; j++)
+                if (i != j && rand() % (2 + round) == 0)
+                    g.adj[i][j] = 1 + rand() % 1000;
+        graphTouch(&g);
+        compressGraph(&g, &cg);
+
+        // Every Edge comes back in ascending Order with its Weight
+        for (int u = 0; u < g.n; u++)
+        {
+            NeighbourIterator it;
+            int v = 0;
+            for (neighbourBegin(&cg, u, &it); neighbourNext(&it); v++)
+            {
+                while (!g.adj[u][v])
+                    v++;
+                assert(it.vertex == v && it.weight == g.adj[u][v]);
+            }
+            while (v < g.n)
+                assert(!g.adj[u][v++]);
+        }
+
+        // Packed Lists are smaller than a plain CSR Layout of ids and Weights
+        assert(compressedGraphBytes(&cg) < (size_t)(g.n + 1) * sizeof(int) + (size_t)cg.edges * 2 * sizeof(int));
+
+        int u = rand() % g.n;
+        assert(compressedBfsDistances(&cg, u, dist, order) == bfsDistances(&g, u, expectedDist, expectedOrder));
+        for (int v = 0; v < g.n; v++)
+            assert(dist[v] == expectedDist[v] && order[v] == expectedOrder[v]);
+        assert(compressedDjkDistances(&cg, u, dist, prev, order) == djkDistances(&g, u, expectedDist, expectedPrev, expectedOrder));
+        for (int v = 0; v < g.n; v++)
+            assert(dist[v] == expectedDist[v] && prev[v] == expectedPrev[v]);
+
+        graphDeinit(&g);
+    }
+    compressedGraphDeinit(&cg);
+    return 1;
+}
+
+// Compressed Graph - Test Case 3
+int test3()
+{
+    // A sparse Graph of nearby Neighbours, the Shape the Varint Gaps pack best
+    graphInit(&g, MAX_VERTICES, NULL);
+    for (int i = 0; i < g.n; i++)
+        for (int d = 1; d <= 3; d++)
+            g.adj[i][(i + d) % g.n] = 1 + (i * d) % 7;
+    graphTouch(&g);
+    compressGraph(&g, &cg);
+    assert(cg.edges == 3 * g.n);
+
+    compressionReport(&g, &cg, 20);
+    compressedGraphDeinit(&cg);
+    graphDeinit(&g);
+    return 1;
+}
+
+int main(void)
+{
+    printf("Compressed Graph - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Compressed Graph - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    printf("Compressed Graph - Test 3 %s\n", test3() ? "PASSED" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "../src/diameter.h"
+
+Graph g;
+EccentricityResult result;
+
+// Eccentricity of every Vertex by one Breadth-First Search each, Edges taken as undirected
+void naiveEccentricities(int ecc[])
+{
+    for (int s = 0; s < g.n; s++)
+    {
+        int dist[MAX_VERTICES], queue[MAX_VERTICES], head = 0, tail = 0;
+        for (int v = 0; v < g.n; v++)
+            dist[v] = -1;
+        dist[s] = 0;
+        queue[tail++] = s;
+        ecc[s] = 0;
+        while (head < tail) {
+            int u = queue[head++];
+            if (dist[u] > ecc[s])
+                ecc[s] = dist[u];
+            for (int v = 0; v < g.n; v++)
+                if (dist[v] == -1 && u != v && (g.adj[u][v] || g.adj[v][u]))
+                {
+                    dist[v] = dist[u] + 1;
+                    queue[tail++] = v;
+                }
+        }
+    }
+}
+
+// Diameter - Test Case 1
+int test1()
+{
+    // A Path of 40 Vertices 0 - 1 - ... - 39 and a Triangle 40 - 41 - 42
+    graphInit(&g, 43, NULL);
+    for (int i = 0; i < 39; i++)
+        g.adj[i][i + 1] = 1;
+    g.adj[40][41] = g.adj[41][42] = g.adj[42][40] = 1;
+    graphTouch(&g);
+
+    eccentricityInit(&result);
+    assert(graphDiameter(&g, 4, &result) == 39);
+    assert(result.radius == 1);
+    assert(result.eccLower[0] == 39 && result.eccUpper[0] == 39);
+    assert(result.bfsRuns < g.n);
+    assert(result.version == g.version);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// Diameter - Test Case 2
+int test2()
+{
+    srand(36);
+    for (int round = 0; round < 40; round++)
+    {
+        graphInit(&g, MAX_VERTICES - round % 7, NULL);
+        for (int i = 0; i < g.n; i++)
+            for (int j = 0; j < g.n; j++)
+                if (i != j && rand() % (20 + 4 * round) == 0)
+                    g.adj[i][j] = 1;
+        graphTouch(&g);
+
+        int ecc[MAX_VERTICES], diameter = 0, radius = -1;
+        naiveEccentricities(ecc);
+        for (int v = 0; v < g.n; v++)
+        {
+            bool isolated = true;
+            for (int w = 0; w < g.n; w++)
+                if (w != v && (g.adj[v][w] || g.adj[w][v]))
+                    isolated = false;
+            if (ecc[v] > diameter)
+                diameter = ecc[v];
+            if (!isolated && (radius == -1 || ecc[v] < radius))
+                radius = ecc[v];
+        }
+
+        assert(graphDiameter(&g, 1 + round % 4, &result) == diameter);
+        assert(result.radius == (radius == -1 ? 0 : radius));
+        assert(ecc[result.peripheral] == diameter);
+        for (int v = 0; v < g.n; v++)
+            assert(result.eccLower[v] <= ecc[v] && ecc[v] <= result.eccUpper[v]);
+
+        graphDeinit(&g);
+    }
+    return 1;
+}
+
+int main(void)
+{
+    printf("Diameter - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Diameter - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,188 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <assert.h>
+
+#include "../src/distanceOracle.h"
+
+Graph g;
+DistanceOracle oracle, loaded;
+
+// Weight of the undirected Edge between u and v as the Oracle sees it (0 if none)
+int undirectedWeight(int u, int v)
+{
+    int forward = (u != v && g.adj[u][v] > 0) ? g.adj[u][v] : 0;
+    int backward = (u != v && g.adj[v][u] > 0) ? g.adj[v][u] : 0;
+    return (forward && backward) ? (forward < backward ? forward : backward) : forward + backward;
+}
+
+// Exact undirected Distances between all Pairs by Floyd-Warshall
+void exactDistances(int dist[MAX_VERTICES][MAX_VERTICES])
+{
+    for (int u = 0; u < g.n; u++)
+        for (int v = 0; v < g.n; v++)
+            dist[u][v] = (u == v) ? 0 : (undirectedWeight(u, v) ? undirectedWeight(u, v) : INT_MAX);
+    for (int m = 0; m < g.n; m++)
+        for (int u = 0; u < g.n; u++)
+            for (int v = 0; v < g.n; v++)
+                if (dist[u][m] != INT_MAX && dist[m][v] != INT_MAX && dist[u][m] + dist[m][v] < dist[u][v])
+                    dist[u][v] = dist[u][m] + dist[m][v];
+}
+
+// Hand-built two Level Oracle of the Path 0 - 1 - ... - n-1 with Vertex 0 as the only top Landmark
+// Each Bunch holds the Vertex itself and Vertex 0, so Walks between Neighbours go all the Way round 0
+void chainOracle(int n)
+{
+    oracleInit(&oracle);
+    oracle.n = n;
+    oracle.k = 2;
+    for (int v = 0; v < n; v++)
+    {
+        oracle.pivot[0][v] = v;
+        oracle.pivotDistance[0][v] = 0;
+        oracle.pivot[1][v] = 0;
+        oracle.pivotDistance[1][v] = v;
+
+        for (int i = 0; i < ORACLE_WORDS; i++)
+            oracle.bunch[v][i] = 0;
+        oracle.bunch[v][0] |= 1;
+        oracle.bunch[v][v / 64] |= 1ULL << (v % 64);
+        oracle.bunchStart[v] = oracle.entries;
+        oracle.distance[oracle.entries] = v;
+        oracle.next[oracle.entries++] = v - 1;
+        if (v > 0)
+        {
+            oracle.distance[oracle.entries] = 0;
+            oracle.next[oracle.entries++] = -1;
+        }
+    }
+    oracle.bunchStart[n] = oracle.entries;
+}
+
+// Distance Oracle - Test Case 1
+int test1()
+{
+    // A Path 0 - 1 - 2 - 3 and an isolated Vertex 4, exact with a single Level
+    graphInit(&g, 5, NULL);
+    g.adj[0][1] = 2;
+    g.adj[2][1] = 3;
+    g.adj[2][3] = 4;
+    graphTouch(&g);
+
+    oracleInit(&oracle);
+    assert(buildDistanceOracle(&g, 1, 1, 2, &oracle) == 4 * 4 + 1);
+    assert(oracle.version == g.version);
+
+    int path[ORACLE_MAX_PATH], hops;
+    assert(oracleDistance(&oracle, 0, 3, path, ORACLE_MAX_PATH, &hops) == 9);
+    assert(hops == 4 && path[0] == 0 && path[1] == 1 && path[2] == 2 && path[3] == 3);
+    assert(oracleDistance(&oracle, 3, 3, path, ORACLE_MAX_PATH, &hops) == 0 && hops == 1);
+    assert(oracleDistance(&oracle, 0, 4, NULL, 0, NULL) == INT_MAX);
+    graphDeinit(&g);
+
+    // The Walk through a far Centre may be longer than n, and is refused if it does not fit
+    chainOracle(MAX_VERTICES);
+    int estimate = oracleDistance(&oracle, MAX_VERTICES - 2, MAX_VERTICES - 1, path, ORACLE_MAX_PATH, &hops);
+    assert(hops == 2 * MAX_VERTICES - 2 && hops - 1 == estimate);
+    assert(path[0] == MAX_VERTICES - 2 && path[MAX_VERTICES - 2] == 0 && path[hops - 1] == MAX_VERTICES - 1);
+    assert(oracleDistance(&oracle, MAX_VERTICES - 2, MAX_VERTICES - 1, path, MAX_VERTICES, &hops) == -1);
+    return 1;
+}
+
+// Distance Oracle - Test Case 2
+int test2()
+{
+    int dist[MAX_VERTICES][MAX_VERTICES], path[ORACLE_MAX_PATH], hops;
+
+    srand(37);
+    for (int round = 0; round < 24; round++)
+    {
+        graphInit(&g, MAX_VERTICES, NULL);
+        for (int i = 0; i < g.n; i++)
+            for (int j = 0; j < g.n; j++)
+                if (i != j && rand() % (12 + round) == 0)
+                    g.adj[i][j] = 1 + rand() % 9;
+        graphTouch(&g);
+        exactDistances(dist);
+
+        int k = 1 + round % 4;
+        buildDistanceOracle(&g, k, round, 4, &oracle);
+        for (int u = 0; u < g.n; u++)
+            for (int v = 0; v < g.n; v++)
+            {
+                int estimate = oracleDistance(&oracle, u, v, path, ORACLE_MAX_PATH, &hops);
+                if (dist[u][v] == INT_MAX)
+                {
+                    assert(estimate == INT_MAX);
+                    continue;
+                }
+                assert(estimate >= dist[u][v] && estimate <= (2 * k - 1) * dist[u][v]);
+
+                // The Path is a Walk along Edges whose Length is the Estimate
+                int length = 0;
+                assert(path[0] == u && path[hops - 1] == v);
+                for (int i = 1; i < hops; i++)
+                {
+                    assert(undirectedWeight(path[i - 1], path[i]) > 0);
+                    length += undirectedWeight(path[i - 1], path[i]);
+                }
+                assert(length == estimate);
+            }
+
+        graphDeinit(&g);
+    }
+    return 1;
+}
+
+// Distance Oracle - Test Case 3
+int test3()
+{
+    graphInit(&g, 40, NULL);
+    for (int i = 0; i < g.n; i++)
+        g.adj[i][(i + 1) % g.n] = g.adj[i][(i + 7) % g.n] = 1 + i % 5;
+    graphTouch(&g);
+
+    buildDistanceOracle(&g, 3, 5, 4, &oracle);
+    assert(oracleSave(&oracle, "oracle_test.bin") == 0);
+    assert(oracleLoad(&loaded, "oracle_test.bin") == 0);
+    assert(loaded.n == oracle.n && loaded.k == oracle.k && loaded.entries == oracle.entries);
+    for (int u = 0; u < g.n; u++)
+        for (int v = 0; v < g.n; v++)
+            assert(oracleDistance(&loaded, u, v, NULL, 0, NULL) == oracleDistance(&oracle, u, v, NULL, 0, NULL));
+    remove("oracle_test.bin");
+
+    // Files whose Pivots or Next Vertices are out of range, or whose Walks do not reach their Centre, are refused
+    chainOracle(8);
+    assert(oracleSave(&oracle, "oracle_test.bin") == 0);
+    assert(oracleLoad(&loaded, "oracle_test.bin") == 0);
+    oracle.pivot[1][3] = 8;
+    assert(oracleSave(&oracle, "oracle_test.bin") == 0);
+    assert(oracleLoad(&loaded, "oracle_test.bin") == -1 && loaded.n == 0);
+    chainOracle(8);
+    oracle.pivotDistance[1][3] = 2;
+    assert(oracleSave(&oracle, "oracle_test.bin") == 0);
+    assert(oracleLoad(&loaded, "oracle_test.bin") == -1);
+    chainOracle(8);
+    oracle.next[oracle.bunchStart[5]] = -2;
+    assert(oracleSave(&oracle, "oracle_test.bin") == 0);
+    assert(oracleLoad(&loaded, "oracle_test.bin") == -1);
+    chainOracle(8);
+    oracle.next[oracle.bunchStart[5]] = 6;
+    assert(oracleSave(&oracle, "oracle_test.bin") == 0);
+    assert(oracleLoad(&loaded, "oracle_test.bin") == -1);
+    remove("oracle_test.bin");
+
+    assert(oracleLoad(&loaded, "test.csv") == -1);
+    assert(oracleLoad(&loaded, "missing.bin") == -1);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+int main(void)
+{
+    printf("Distance Oracle - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Distance Oracle - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    printf("Distance Oracle - Test 3 %s\n", test3() ? "PASSED" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+
+#include "../src/forceLayout.h"
+
+Graph g;
+ForceLayout layout, parallelLayout;
+Vector2 points[MAX_VERTICES];
+
+// Length of the Vector from a to b
+float distance(Vector2 a, Vector2 b)
+{
+    return sqrtf((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
+}
+
+// Force Layout - Test Case 1
+int test1()
+{
+    // With an Opening Angle of 0 the Quadtree must give the exact Repulsion of every Pair
+    srand(3);
+    graphInit(&g, MAX_VERTICES, NULL);
+    for (int i = 0; i < g.n; i++)
+        points[i] = (Vector2){(float)(rand() % 1280), (float)(rand() % 720)};
+    forceLayoutInit(&layout, &g, points, g.n, (Vector2){640, 360}, 200);
+    layout.theta = 0.0f;
+    forceLayoutStep(&layout, 4);
+
+    for (int v = 0; v < g.n; v++)
+    {
+        Vector2 expected = {-(points[v].x - 640) * LAYOUT_GRAVITY, -(points[v].y - 360) * LAYOUT_GRAVITY};
+        for (int u = 0; u < g.n; u++)
+        {
+            float d = distance(points[u], points[v]);
+            if (u == v || d == 0.0f)
+                continue;
+            expected.x += (points[v].x - points[u].x) / d * layout.k * layout.k / d;
+            expected.y += (points[v].y - points[u].y) / d * layout.k * layout.k / d;
+        }
+        assert(fabsf(layout.displacement[v].x - expected.x) <= 1e-3f * (1.0f + fabsf(expected.x)));
+        assert(fabsf(layout.displacement[v].y - expected.y) <= 1e-3f * (1.0f + fabsf(expected.y)));
+    }
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// Force Layout - Test Case 2
+int test2()
+{
+    // A Ring of Vertices scattered at random unfolds with Neighbours closer than Non-Neighbours,
+    // and the Result does not depend on the Number of Threads
+    srand(11);
+    graphInit(&g, 40, NULL);
+    for (int i = 0; i < g.n; i++)
+    {
+        g.adj[i][(i + 1) % g.n] = 1;
+        points[i] = (Vector2){(float)(rand() % 1280), (float)(rand() % 720)};
+    }
+    graphTouch(&g);
+
+    forceLayoutInit(&layout, &g, points, g.n, (Vector2){640, 360}, 200);
+    forceLayoutInit(&parallelLayout, &g, points, g.n, (Vector2){640, 360}, 200);
+    layout.pinned = parallelLayout.pinned = 7;
+    int iterations = 0;
+    while (!forceLayoutStep(&layout, 1))
+    {
+        assert(forceLayoutStep(&parallelLayout, 4) == false);
+        iterations++;
+    }
+    assert(forceLayoutStep(&parallelLayout, 4));
+    assert(iterations < LAYOUT_MAX_ITERATIONS);
+    assert(memcmp(layout.positions, parallelLayout.positions, g.n * sizeof(Vector2)) == 0);
+    assert(layout.positions[7].x == points[7].x && layout.positions[7].y == points[7].y);
+
+    float neighbours = 0.0f, others = 0.0f;
+    int otherCount = 0;
+    for (int u = 0; u < g.n; u++)
+    {
+        assert(!isnan(layout.positions[u].x) && !isnan(layout.positions[u].y));
+        neighbours += distance(layout.positions[u], layout.positions[(u + 1) % g.n]);
+        for (int v = u + 2; v < g.n; v++)
+            if ((v + 1) % g.n != u)
+            {
+                others += distance(layout.positions[u], layout.positions[v]);
+                otherCount++;
+            }
+    }
+    assert(neighbours / g.n < 0.5f * others / otherCount);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// Force Layout - Test Case 3
+int test3()
+{
+    // Vertices starting on the same Spot are pushed apart without ever becoming NaN
+    graphInit(&g, 20, NULL);
+    for (int i = 0; i < g.n; i++)
+        points[i] = (Vector2){100, 100};
+    g.adj[0][1] = 1;
+    graphTouch(&g);
+
+    forceLayoutInit(&layout, &g, points, g.n, (Vector2){640, 360}, 200);
+    while (!forceLayoutStep(&layout, 4))
+        ;
+    for (int u = 0; u < g.n; u++)
+    {
+        assert(!isnan(layout.positions[u].x) && !isnan(layout.positions[u].y));
+        for (int v = u + 1; v < g.n; v++)
+            assert(distance(layout.positions[u], layout.positions[v]) > 1.0f);
+    }
+
+    // An empty Graph is converged from the Start
+    graphDeinit(&g);
+    graphInit(&g, 0, NULL);
+    forceLayoutInit(&layout, &g, points, 0, (Vector2){640, 360}, 200);
+    assert(forceLayoutStep(&layout, 4));
+
+    graphDeinit(&g);
+    return 1;
+}
+
+int main(void)
+{
+    printf("Force Layout - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Force Layout - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    printf("Force Layout - Test 3 %s\n", test3() ? "PASSED" : "FAILED");
+    return 0;
+}
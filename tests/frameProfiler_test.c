@@ -0,0 +1,84 @@
+#include <stdio.h>
+#include <assert.h>
+
+#include "../src/frameProfiler.h"
+
+FrameProfiler profiler;
+
+// Frame Profiler - Test Case 1
+int test1()
+{
+    // Frames of 1 to 100 ms with the Update taking a tenth of each
+    profilerInit(&profiler);
+    for (int i = 1; i <= 100; i++)
+    {
+        float phases[PROFILE_PHASES] = {0};
+        phases[PROFILE_UPDATE] = i * 0.0001f;
+        profilerRecord(&profiler, phases, i * 0.001f);
+    }
+    assert(profilerFrameCount(&profiler) == 100);
+    assert(profilerFrame(&profiler, 0) == 100 * 0.001f);
+    assert(profilerFrame(&profiler, 99) == 0.001f);
+    assert(profilerPercentile(&profiler, PROFILE_PHASES, 0.5f) == 51 * 0.001f);
+    assert(profilerPercentile(&profiler, PROFILE_PHASES, 0.99f) == 99 * 0.001f);
+    assert(profilerPercentile(&profiler, PROFILE_UPDATE, 0.0f) == 0.0001f);
+    assert(profilerPercentile(&profiler, PROFILE_GUI, 0.99f) == 0.0f);
+
+    // The Ring Buffer keeps only the latest Frames
+    for (int i = 0; i < PROFILE_FRAMES; i++)
+    {
+        float phases[PROFILE_PHASES] = {0};
+        profilerRecord(&profiler, phases, 0.016f);
+    }
+    assert(profilerFrameCount(&profiler) == PROFILE_FRAMES);
+    assert(profilerPercentile(&profiler, PROFILE_PHASES, 1.0f) == 0.016f);
+    return 1;
+}
+
+// Frame Profiler - Test Case 2
+int test2()
+{
+    // Disabled, Timers record nothing
+    profilerInit(&profiler);
+    profilerBeginFrame(&profiler);
+    profilerBegin(&profiler, PROFILE_EDGES);
+    profilerEnd(&profiler, PROFILE_EDGES);
+    profilerEndFrame(&profiler);
+    assert(profilerFrameCount(&profiler) == 0);
+    assert(profilerPercentile(&profiler, PROFILE_PHASES, 0.5f) == 0.0f);
+
+    // Enabled, a Phase entered twice in a Frame adds up, and Phases never exceed the Frame
+    profilerEnable(&profiler, true);
+    for (int frame = 0; frame < 3; frame++)
+    {
+        profilerBeginFrame(&profiler);
+        for (int k = 0; k < 2; k++)
+        {
+            profilerBegin(&profiler, PROFILE_VERTICES);
+            volatile double sink = 0.0;
+            for (int i = 0; i < 100000; i++)
+                sink += i;
+            profilerEnd(&profiler, PROFILE_VERTICES);
+        }
+        profilerEndFrame(&profiler);
+    }
+    assert(profilerFrameCount(&profiler) == 3);
+    for (int i = 0; i < 3; i++)
+    {
+        assert(profiler.phaseSeconds[i][PROFILE_VERTICES] > 0.0f);
+        assert(profiler.phaseSeconds[i][PROFILE_VERTICES] <= profiler.frameSeconds[i]);
+    }
+
+    // Enabling again starts afresh
+    profilerEnable(&profiler, false);
+    profilerEnable(&profiler, true);
+    assert(profilerFrameCount(&profiler) == 0);
+    return 1;
+}
+
+int main(void)
+{
+    printf("Frame Profiler - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Frame Profiler - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,154 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <assert.h>
+
+#include "../src/graphStore.h"
+
+#define TEST_READERS 3
+#define TEST_PUBLISHES 5000
+
+Graph g;
+GraphStore store;
+atomic_bool writerDone;
+
+// Check if every Weight of a Version is the same, as the Writer below always leaves it
+bool uniform(Graph *version)
+{
+    int weight = version->adj[0][0];
+    for (int i = 0; i < version->n; i++)
+        for (int j = 0; j < version->n; j++)
+            if (version->adj[i][j] != weight)
+                return false;
+    return true;
+}
+
+// Pin the latest Version over and over, checking it never changes while pinned
+void *reader(void *arg)
+{
+    (void)arg;
+    while (!atomic_load(&writerDone))
+    {
+        GraphVersion *version = graphStorePin(&store);
+        int weight = version->graph.adj[0][0];
+        assert(uniform(&version->graph));
+        assert(version->graph.adj[version->graph.n - 1][version->graph.n - 1] == weight);
+        graphStoreUnpin(version);
+    }
+    return NULL;
+}
+
+// Graph Store - Test Case 1
+int test1()
+{
+    graphInit(&g, 4, NULL);
+    g.adj[0][1] = 5;
+    graphTouch(&g);
+    graphStoreInit(&store, &g);
+
+    // A pinned Version keeps its Weights while the Graph is edited and republished
+    GraphVersion *before = graphStorePin(&store);
+    assert(before->graph.adj[0][1] == 5 && before->graph.version == g.version);
+    g.adj[0][1] = 9;
+    graphTouch(&g);
+    assert(graphStorePublish(&store, &g) == 0);
+    GraphVersion *after = graphStorePin(&store);
+    assert(after != before);
+    assert(before->graph.adj[0][1] == 5 && after->graph.adj[0][1] == 9);
+    assert(after->graph.version == g.version);
+
+    // Publishing an unchanged Graph keeps the current Version
+    assert(graphStorePublish(&store, &g) == 0);
+    assert(graphStorePin(&store) == after);
+    graphStoreUnpin(after);
+    graphStoreUnpin(after);
+
+    // With every other Version pinned nothing can be published, until one is let go
+    GraphVersion *pinned[GRAPH_STORE_VERSIONS];
+    pinned[0] = before;
+    for (int i = 1; i < GRAPH_STORE_VERSIONS; i++)
+    {
+        g.adj[1][2] = i;
+        graphTouch(&g);
+        assert(graphStorePublish(&store, &g) == 0);
+        pinned[i] = graphStorePin(&store);
+        assert(pinned[i]->graph.adj[1][2] == i);
+    }
+    graphTouch(&g);
+    assert(graphStorePublish(&store, &g) == -1);
+    graphStoreUnpin(before);
+    assert(graphStorePublish(&store, &g) == 0);
+    assert(graphStorePin(&store) == before);
+    assert(before->graph.adj[0][1] == 9 && before->graph.adj[1][2] == GRAPH_STORE_VERSIONS - 1);
+
+    graphStoreUnpin(before);
+    for (int i = 1; i < GRAPH_STORE_VERSIONS; i++)
+        graphStoreUnpin(pinned[i]);
+
+    // Reusing a Version follows renamed, removed and added Vertices
+    for (int i = 0; i < GRAPH_STORE_VERSIONS; i++)
+    {
+        editVertex(&g, g.labels[1], (i % 2) ? "X" : "Y");
+        if (i % 3 == 0)
+            addVertex(&g, "Z");
+        assert(graphStorePublish(&store, &g) == 0);
+    }
+    Graph smaller;
+    int kept[] = {0, 1};
+    inducedSubgraph(&g, kept, 2, &smaller);
+    assert(graphStorePublish(&store, &smaller) == 0);
+    GraphVersion *latest = graphStorePin(&store);
+    assert(latest->graph.n == 2 && latest->graph.version == smaller.version);
+    assert(strcmp(latest->graph.labels[0], "0") == 0 && strcmp(latest->graph.labels[1], "X") == 0);
+    assert(latest->graph.adj[0][1] == 9);
+    graphStoreUnpin(latest);
+    graphDeinit(&smaller);
+
+    graphStoreDeinit(&store);
+    graphDeinit(&g);
+    return 1;
+}
+
+// Graph Store - Test Case 2
+int test2()
+{
+    // Readers racing the Writer only ever see whole Versions, and the Writer only fails while all are pinned
+    graphInit(&g, MAX_VERTICES, NULL);
+    graphStoreInit(&store, &g);
+    atomic_store(&writerDone, false);
+
+    pthread_t threads[TEST_READERS];
+    for (int t = 0; t < TEST_READERS; t++)
+        pthread_create(&threads[t], NULL, reader, NULL);
+
+    int published = 0;
+    for (int weight = 1; published < TEST_PUBLISHES; weight++)
+    {
+        for (int i = 0; i < g.n; i++)
+            for (int j = 0; j < g.n; j++)
+                g.adj[i][j] = weight;
+        graphTouch(&g);
+        while (graphStorePublish(&store, &g) != 0)
+            ;
+        published++;
+    }
+    atomic_store(&writerDone, true);
+    for (int t = 0; t < TEST_READERS; t++)
+        pthread_join(threads[t], NULL);
+
+    GraphVersion *latest = graphStorePin(&store);
+    assert(latest->graph.adj[0][0] == TEST_PUBLISHES && latest->graph.version == g.version);
+    graphStoreUnpin(latest);
+
+    graphStoreDeinit(&store);
+    graphDeinit(&g);
+    return 1;
+}
+
+int main(void)
+{
+    printf("Graph Store - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Graph Store - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
+#include <limits.h>
 
 #include "../src/graph.h"
 
@@ -196,6 +197,74 @@ int test5()
     return 1;
 }
 
+// Graph - Test Case 6
+int test6()
+{
+    graphInit(&g, 6, NULL);
+
+    editEdge(&g, "0", "1", 7);
+    editEdge(&g, "0", "2", 2);
+    editEdge(&g, "2", "1", 3);
+    editEdge(&g, "1", "3", 1);
+    editEdge(&g, "2", "3", 8);
+    editEdge(&g, "5", "0", 1);
+
+    int dist[MAX_VERTICES], prev[MAX_VERTICES], order[MAX_VERTICES];
+
+    assert(bfsDistances(&g, 0, dist, order) == 4);
+    assert(order[0] == 0);
+    assert(dist[0] == 0 && dist[1] == 1 && dist[2] == 1 && dist[3] == 2);
+    assert(dist[4] == -1 && dist[5] == -1);
+
+    assert(djkDistances(&g, 0, dist, prev, order) == 4);
+    assert(dist[1] == 5 && dist[2] == 2 && dist[3] == 6);
+    assert(dist[4] == INT_MAX && dist[5] == INT_MAX);
+    assert(prev[1] == 2 && prev[3] == 1 && prev[0] == -1);
+    assert(order[0] == 0 && order[1] == 2 && order[2] == 1 && order[3] == 3);
+
+    assert(findVertex(&g, "3") == 3);
+    assert(findVertex(&g, "Z") == -1);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// Graph - Test Case 7
+int test7()
+{
+    graphInit(&g, 7, NULL);
+
+    // A Chain 0 -> 1 -> 2 -> 3 -> 4 with a Shortcut 0 -> 3 and a Vertex 6 only reaching 0
+    editEdge(&g, "0", "1", 1);
+    editEdge(&g, "1", "2", 1);
+    editEdge(&g, "2", "3", 1);
+    editEdge(&g, "3", "4", 1);
+    editEdge(&g, "0", "3", 5);
+    editEdge(&g, "6", "0", 1);
+
+    int ball[MAX_VERTICES], dist[MAX_VERTICES];
+
+    assert(bfsBall(&g, 0, 1, ball, dist) == 3);
+    assert(ball[0] == 0 && ball[1] == 1 && ball[2] == 3);
+    assert(dist[0] == 0 && dist[1] == 1 && dist[2] == 1);
+    assert(bfsBall(&g, 0, 0, ball, dist) == 1);
+    assert(bfsBall(&g, 0, 10, ball, dist) == 5);
+
+    assert(djkBall(&g, 0, 3, ball, dist) == 4);
+    assert(ball[3] == 3 && dist[3] == 3);
+    assert(djkBall(&g, 0, 2, ball, dist) == 3);
+
+    Graph sub;
+    assert(djkBall(&g, 0, 4, ball, dist) == 5);
+    assert(inducedSubgraph(&g, ball, 5, &sub) == 0);
+    assert(sub.n == 5 && strcmp(sub.labels[3], "3") == 0 && strcmp(sub.labels[4], "4") == 0);
+    assert(sub.adj[0][1] == 1 && sub.adj[0][3] == 5 && sub.adj[3][4] == 1 && sub.adj[4][3] == 0);
+    graphDeinit(&sub);
+
+    graphDeinit(&g);
+    return 1;
+}
+
 int main(void)
 {
     printf("Graph - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
@@ -203,5 +272,7 @@ int main(void)
     printf("Graph - Test 3 %s\n", test3() ? "PASSED" : "FAILED");
     printf("Graph - Test 4 %s\n", test4() ? "PASSED" : "FAILED");
     printf("Graph - Test 5 %s\n", test5() ? "PASSED" : "FAILED");
+    printf("Graph - Test 6 %s\n", test6() ? "PASSED" : "FAILED");
+    printf("Graph - Test 7 %s\n", test7() ? "PASSED" : "FAILED");
     return 0;
 }
@@ -0,0 +1,77 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "../src/kCore.h"
+
+Graph g;
+CoreResult result, parallelResult;
+
+// K-Core - Test Case 1
+int test1()
+{
+    // A 4-Clique 0-3, a Triangle-free Tail 3 - 4 - 5, and an isolated Vertex 6
+    graphInit(&g, 7, NULL);
+    for (int i = 0; i < 4; i++)
+        for (int j = i + 1; j < 4; j++)
+            g.adj[i][j] = 1;
+    g.adj[3][4] = 1;
+    g.adj[5][4] = 1;
+    graphTouch(&g);
+
+    coreResultInit(&result);
+    coreResultInit(&parallelResult);
+    assert(coreDecomposition(&g, &result) == 3);
+    assert(parallelCoreDecomposition(&g, 4, &parallelResult) == 3);
+
+    int expected[] = {3, 3, 3, 3, 1, 1, 0};
+    for (int i = 0; i < g.n; i++)
+    {
+        assert(result.core[i] == expected[i]);
+        assert(parallelResult.core[i] == expected[i]);
+    }
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// K-Core - Test Case 2
+int test2()
+{
+    srand(17);
+    for (int round = 0; round < 30; round++)
+    {
+        graphInit(&g, MAX_VERTICES, NULL);
+        for (int i = 0; i < g.n; i++)
+            for (int j = 0; j < g.n; j++)
+                if (i != j && rand() % (4 + round) == 0)
+                    g.adj[i][j] = 1;
+        graphTouch(&g);
+
+        coreDecomposition(&g, &result);
+        parallelCoreDecomposition(&g, 4, &parallelResult);
+        assert(result.maxCore == parallelResult.maxCore);
+        for (int i = 0; i < g.n; i++)
+            assert(result.core[i] == parallelResult.core[i]);
+
+        // Every Vertex of the k-Core has at least k Neighbours inside it
+        for (int v = 0; v < g.n; v++)
+        {
+            int inside = 0;
+            for (int w = 0; w < g.n; w++)
+                if (w != v && (g.adj[v][w] || g.adj[w][v]) && result.core[w] >= result.core[v])
+                    inside++;
+            assert(inside >= result.core[v]);
+        }
+
+        graphDeinit(&g);
+    }
+    return 1;
+}
+
+int main(void)
+{
+    printf("K-Core - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("K-Core - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <assert.h>
+
+#include "../src/kShortestPaths.h"
+
+Graph g;
+PathSet paths;
+
+int allLengths[4096];
+int allCount;
+
+// Collect the Length of every simple Path from u to dest
+void enumeratePaths(int u, int dest, bool visited[], int length)
+{
+    if (u == dest)
+    {
+        allLengths[allCount++] = length;
+        return;
+    }
+    visited[u] = true;
+    for (int v = 0; v < g.n; v++)
+        if (g.adj[u][v] > 0 && !visited[v])
+            enumeratePaths(v, dest, visited, length + g.adj[u][v]);
+    visited[u] = false;
+}
+
+int compareInts(const void *a, const void *b)
+{
+    return *(const int *)a - *(const int *)b;
+}
+
+// K Shortest Paths - Test Case 1
+int test1()
+{
+    // Two Routes 0 - 1 - 3 (2) and 0 - 2 - 3 (5), and a Detour 1 - 2 (1)
+    graphInit(&g, 4, NULL);
+    g.adj[0][1] = 1;
+    g.adj[1][3] = 1;
+    g.adj[0][2] = 2;
+    g.adj[2][3] = 3;
+    g.adj[1][2] = 1;
+    graphTouch(&g);
+
+    pathSetInit(&paths);
+    assert(kShortestPaths(&g, 0, 3, 5, 2, &paths) == 3);
+
+    int expectedLength[] = {2, 5, 5};
+    int expectedHops[] = {3, 3, 4};
+    for (int i = 0; i < 3; i++)
+    {
+        assert(paths.length[i] == expectedLength[i]);
+        assert(paths.hops[i] == expectedHops[i]);
+        assert(paths.vertices[i][0] == 0 && paths.vertices[i][paths.hops[i] - 1] == 3);
+    }
+    assert(paths.version == g.version);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// K Shortest Paths - Test Case 2
+int test2()
+{
+    // No Path to an unreachable Vertex, a single Vertex Path to the Source itself
+    graphInit(&g, 3, NULL);
+    g.adj[0][1] = 4;
+    graphTouch(&g);
+
+    assert(kShortestPaths(&g, 0, 2, 4, 1, &paths) == 0);
+    assert(kShortestPaths(&g, 1, 0, 4, 1, &paths) == 0);
+    assert(kShortestPaths(&g, 0, 0, 4, 1, &paths) == 1);
+    assert(paths.length[0] == 0 && paths.hops[0] == 1);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// K Shortest Paths - Test Case 3
+int test3()
+{
+    srand(34);
+    for (int round = 0; round < 40; round++)
+    {
+        graphInit(&g, 9, NULL);
+        for (int i = 0; i < g.n; i++)
+            for (int j = 0; j < g.n; j++)
+                if (i != j && rand() % 3 == 0)
+                    g.adj[i][j] = 1 + rand() % 6;
+        graphTouch(&g);
+
+        bool visited[MAX_VERTICES] = {false};
+        allCount = 0;
+        enumeratePaths(0, g.n - 1, visited, 0);
+        qsort(allLengths, allCount, sizeof(int), compareInts);
+
+        int found = kShortestPaths(&g, 0, g.n - 1, MAX_K_PATHS, 4, &paths);
+        assert(found == (allCount < MAX_K_PATHS ? allCount : MAX_K_PATHS));
+
+        for (int p = 0; p < found; p++)
+        {
+            // Lengths match the Brute Force in order and every Path is simple and distinct
+            assert(paths.length[p] == allLengths[p]);
+
+            bool seen[MAX_VERTICES] = {false};
+            int length = 0;
+            for (int i = 0; i < paths.hops[p]; i++)
+            {
+                assert(!seen[paths.vertices[p][i]]);
+                seen[paths.vertices[p][i]] = true;
+                if (i > 0)
+                {
+                    assert(g.adj[paths.vertices[p][i - 1]][paths.vertices[p][i]] > 0);
+                    length += g.adj[paths.vertices[p][i - 1]][paths.vertices[p][i]];
+                }
+            }
+            assert(length == paths.length[p]);
+
+            for (int q = 0; q < p; q++)
+                assert(paths.hops[p] != paths.hops[q] ||
+                       memcmp(paths.vertices[p], paths.vertices[q], paths.hops[p] * sizeof(int)) != 0);
+        }
+
+        graphDeinit(&g);
+    }
+    return 1;
+}
+
+int main(void)
+{
+    printf("K Shortest Paths - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("K Shortest Paths - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    printf("K Shortest Paths - Test 3 %s\n", test3() ? "PASSED" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+
+#include "../src/louvain.h"
+
+Graph g;
+CommunityResult result, parallelResult;
+
+// Connect every Pair of Vertices from first to last
+void addClique(int first, int last)
+{
+    for (int i = first; i <= last; i++)
+        for (int j = first; j <= last; j++)
+            if (i != j)
+                g.adj[i][j] = 1;
+}
+
+// Louvain - Test Case 1
+int test1()
+{
+    // Three 5-Cliques joined in a Ring by single Edges
+    graphInit(&g, 15, NULL);
+    addClique(0, 4);
+    addClique(5, 9);
+    addClique(10, 14);
+    g.adj[4][5] = 1;
+    g.adj[9][10] = 1;
+    g.adj[14][0] = 1;
+    graphTouch(&g);
+
+    communityResultInit(&result);
+    assert(louvainCommunities(&g, 1, &result) == 3);
+
+    for (int c = 0; c < 3; c++)
+        for (int i = 5 * c; i < 5 * c + 5; i++)
+        {
+            assert(result.community[i] == result.community[5 * c]);
+            assert(result.community[i] != result.community[(5 * c + 5) % 15]);
+        }
+
+    assert(result.modularity > 0.5);
+    assert(fabs(result.modularity - modularity(&g, result.community)) < 1e-12);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// Louvain - Test Case 2
+int test2()
+{
+    srand(19);
+    graphInit(&g, MAX_VERTICES, NULL);
+    for (int c = 0; c < 8; c++)
+        for (int i = 8 * c; i < 8 * c + 8; i++)
+            for (int j = 8 * c; j < 8 * c + 8; j++)
+                if (i != j && rand() % 2 == 0)
+                    g.adj[i][j] = 1 + rand() % 3;
+    for (int k = 0; k < 20; k++)
+        g.adj[rand() % MAX_VERTICES][rand() % MAX_VERTICES] = 1;
+    for (int i = 0; i < g.n; i++)
+        g.adj[i][i] = 0;
+    graphTouch(&g);
+
+    louvainCommunities(&g, 1, &result);
+    louvainCommunities(&g, 4, &parallelResult);
+
+    // Moves are chosen against a shared Snapshot, so the Thread Count does not change the Result
+    assert(result.count == parallelResult.count);
+    for (int i = 0; i < g.n; i++)
+        assert(result.community[i] == parallelResult.community[i]);
+
+    // Better than every Vertex alone
+    int singletons[MAX_VERTICES];
+    for (int i = 0; i < g.n; i++)
+        singletons[i] = i;
+    assert(result.modularity > modularity(&g, singletons));
+    assert(result.modularity > 0.4);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+int main(void)
+{
+    printf("Louvain - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Louvain - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "../src/maxFlow.h"
+
+Graph g;
+FlowResult result, parallelResult;
+
+// Maximum Flow by Edmonds-Karp
+long long edmondsKarp(int src, int sink)
+{
+    long long residual[MAX_VERTICES][MAX_VERTICES], total = 0;
+    for (int u = 0; u < g.n; u++)
+        for (int v = 0; v < g.n; v++)
+            residual[u][v] = g.adj[u][v] > 0 ? g.adj[u][v] : 0;
+
+    while (1) {
+        int prev[MAX_VERTICES], queue[MAX_VERTICES], head = 0, tail = 0;
+        for (int v = 0; v < g.n; v++)
+            prev[v] = -1;
+        prev[src] = src;
+        queue[tail++] = src;
+        while (head < tail && prev[sink] == -1) {
+            int u = queue[head++];
+            for (int v = 0; v < g.n; v++)
+                if (prev[v] == -1 && residual[u][v] > 0)
+                {
+                    prev[v] = u;
+                    queue[tail++] = v;
+                }
+        }
+        if (prev[sink] == -1)
+            return total;
+
+        long long amount = -1;
+        for (int v = sink; v != src; v = prev[v])
+            if (amount == -1 || residual[prev[v]][v] < amount)
+                amount = residual[prev[v]][v];
+        for (int v = sink; v != src; v = prev[v])
+        {
+            residual[prev[v]][v] -= amount;
+            residual[v][prev[v]] += amount;
+        }
+        total += amount;
+    }
+}
+
+// Check Capacities, Conservation and that the Cut matches the Flow
+void checkFlow(FlowResult *r)
+{
+    long long cut = 0;
+    for (int u = 0; u < g.n; u++)
+    {
+        long long balance = 0;
+        for (int v = 0; v < g.n; v++)
+        {
+            assert(r->flow[u][v] >= 0 && r->flow[u][v] <= (g.adj[u][v] > 0 ? g.adj[u][v] : 0));
+            balance += r->flow[v][u] - r->flow[u][v];
+            if (r->sourceSide[u] && !r->sourceSide[v] && g.adj[u][v] > 0)
+                cut += g.adj[u][v];
+        }
+        if (u == r->sink)
+            assert(balance == r->value);
+        else if (u != r->src)
+            assert(balance == 0);
+    }
+    assert(r->sourceSide[r->src] && !r->sourceSide[r->sink]);
+    assert(cut == r->value);
+}
+
+// Max Flow - Test Case 1
+int test1()
+{
+    // Two Routes 0 - 1 - 3 and 0 - 2 - 3 joined by 1 - 2, Bottlenecked at 3
+    graphInit(&g, 4, NULL);
+    g.adj[0][1] = 3;
+    g.adj[0][2] = 2;
+    g.adj[1][2] = 5;
+    g.adj[1][3] = 2;
+    g.adj[2][3] = 3;
+    graphTouch(&g);
+
+    flowResultInit(&result);
+    flowResultInit(&parallelResult);
+    assert(maxFlow(&g, 0, 3, &result) == 5);
+    assert(parallelMaxFlow(&g, 0, 3, 4, &parallelResult) == 5);
+    checkFlow(&result);
+    checkFlow(&parallelResult);
+    assert(result.cutEdges == 2 && result.version == g.version);
+
+    // Nothing reaches an isolated Sink
+    g.adj[1][3] = 0;
+    g.adj[2][3] = 0;
+    graphTouch(&g);
+    assert(maxFlow(&g, 0, 3, &result) == 0);
+    assert(parallelMaxFlow(&g, 0, 3, 4, &parallelResult) == 0);
+    checkFlow(&result);
+    checkFlow(&parallelResult);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// Max Flow - Test Case 2
+int test2()
+{
+    srand(35);
+    for (int round = 0; round < 40; round++)
+    {
+        graphInit(&g, (round % 2) ? MAX_VERTICES : 12, NULL);
+        for (int i = 0; i < g.n; i++)
+            for (int j = 0; j < g.n; j++)
+                if (i != j && rand() % (3 + round % 5) == 0)
+                    g.adj[i][j] = 1 + rand() % 20;
+        graphTouch(&g);
+
+        int src = rand() % g.n, sink = (src + 1 + rand() % (g.n - 1)) % g.n;
+        long long expected = edmondsKarp(src, sink);
+        assert(maxFlow(&g, src, sink, &result) == expected);
+        assert(parallelMaxFlow(&g, src, sink, 4, &parallelResult) == expected);
+        checkFlow(&result);
+        checkFlow(&parallelResult);
+
+        graphDeinit(&g);
+    }
+    return 1;
+}
+
+int main(void)
+{
+    printf("Max Flow - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Max Flow - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+
+#include "../src/pageRank.h"
+
+Graph g;
+PageRankResult result, parallelResult;
+
+// PageRank - Test Case 1
+int test1()
+{
+    graphInit(&g, 4, NULL);
+    addEdge(&g, "0", "1");
+    addEdge(&g, "1", "2");
+    addEdge(&g, "2", "3");
+    addEdge(&g, "3", "0");
+
+    pageRank(&g, PAGERANK_DAMPING, PAGERANK_TOLERANCE, 1, &result);
+
+    assert(result.converged);
+    for (int i = 0; i < g.n; i++)
+        assert(fabsf(result.rank[i] - 0.25f) < 1e-4f);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// PageRank - Test Case 2
+int test2()
+{
+    // Every Vertex points at 0, which has no Out-Edges
+    graphInit(&g, 5, NULL);
+    addEdge(&g, "1", "0");
+    addEdge(&g, "2", "0");
+    addEdge(&g, "3", "0");
+    addEdge(&g, "4", "0");
+
+    pageRank(&g, PAGERANK_DAMPING, PAGERANK_TOLERANCE, 1, &result);
+
+    float total = 0.0f;
+    for (int i = 0; i < g.n; i++)
+        total += result.rank[i];
+    assert(fabsf(total - 1.0f) < 1e-4f);
+    assert(result.rank[0] == result.maxRank);
+    for (int i = 2; i < g.n; i++)
+        assert(fabsf(result.rank[i] - result.rank[1]) < 1e-5f);
+
+    // Teleporting only to 1 favours it over 2
+    float personalization[5] = {0, 1, 0, 0, 0};
+    personalizedPageRank(&g, personalization, PAGERANK_DAMPING, PAGERANK_TOLERANCE, 1, &result);
+    assert(result.rank[1] > result.rank[2]);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// PageRank - Test Case 3
+int test3()
+{
+    srand(3);
+    graphInit(&g, MAX_VERTICES, NULL);
+    for (int i = 0; i < g.n; i++)
+        for (int j = 0; j < g.n; j++)
+            if (i != j && rand() % 10 == 0)
+                g.adj[i][j] = 1;
+    graphTouch(&g);
+
+    pageRank(&g, PAGERANK_DAMPING, PAGERANK_TOLERANCE, 1, &result);
+    pageRank(&g, PAGERANK_DAMPING, PAGERANK_TOLERANCE, 4, &parallelResult);
+
+    assert(result.iterations == parallelResult.iterations);
+    assert(result.version == g.version);
+    for (int i = 0; i < g.n; i++)
+        assert(fabsf(result.rank[i] - parallelResult.rank[i]) < 1e-6f);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+int main(void)
+{
+    printf("PageRank - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("PageRank - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    printf("PageRank - Test 3 %s\n", test3() ? "PASSED" : "FAILED");
+    return 0;
+}
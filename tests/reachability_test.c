@@ -0,0 +1,84 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "../src/reachability.h"
+
+Graph g;
+
+// Reachability - Test Case 1
+int test1()
+{
+    char *labels[] = {"a", "b", "c", "d", "e"};
+    graphInit(&g, 5, labels);
+
+    addEdge(&g, "a", "b");
+    addEdge(&g, "b", "a");
+    addEdge(&g, "b", "c");
+    addEdge(&g, "d", "c");
+
+    ReachabilityIndex index;
+    reachabilityInit(&index);
+
+    assert(reachable(&index, &g, 0, 2));
+    assert(reachable(&index, &g, 1, 0));
+    assert(reachable(&index, &g, 3, 2));
+    assert(!reachable(&index, &g, 2, 0));
+    assert(!reachable(&index, &g, 0, 3));
+    assert(!reachable(&index, &g, 0, 4));
+    assert(index.componentCount == 4);
+
+    // The Index is rebuilt once the Graph changes
+    addEdge(&g, "c", "e");
+    assert(reachable(&index, &g, 0, 4));
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// Reachability - Test Case 2
+int test2()
+{
+    srand(7);
+    for (int round = 0; round < 50; round++)
+    {
+        graphInit(&g, MAX_VERTICES, NULL);
+        for (int i = 0; i < g.n; i++)
+            for (int j = 0; j < g.n; j++)
+                if (i != j && rand() % 80 == 0)
+                    g.adj[i][j] = 1 + rand() % 9;
+        graphTouch(&g);
+
+        ReachabilityIndex index;
+        reachabilityInit(&index);
+
+        for (int u = 0; u < g.n; u++)
+        {
+            int visited[MAX_VERTICES] = {0};
+            int queue[MAX_VERTICES], front = 0, rear = 0;
+            visited[u] = 1;
+            queue[rear++] = u;
+            while (front < rear) {
+                int w = queue[front++];
+                for (int v = 0; v < g.n; v++)
+                    if (g.adj[w][v] && !visited[v]) {
+                        visited[v] = 1;
+                        queue[rear++] = v;
+                    }
+            }
+
+            for (int v = 0; v < g.n; v++)
+                assert(reachable(&index, &g, u, v) == visited[v]);
+        }
+
+        graphDeinit(&g);
+    }
+    return 1;
+}
+
+int main(void)
+{
+    printf("Reachability - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Reachability - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,192 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include "../src/reorder.h"
+#include "../src/parallel.h"
+
+Graph g, reordered;
+Permutation perm;
+
+// Check that the Permutation is a Bijection and the reordered Graph has the same Edges and Labels
+void checkPermutation(void)
+{
+    bool used[MAX_VERTICES] = {false};
+    assert(perm.n == g.n);
+    for (int i = 0; i < g.n; i++)
+    {
+        assert(!used[perm.oldIndex[i]]);
+        used[perm.oldIndex[i]] = true;
+        assert(perm.newIndex[perm.oldIndex[i]] == i);
+    }
+
+    assert(permuteGraph(&g, &perm, &reordered) == 0);
+    for (int u = 0; u < g.n; u++)
+    {
+        assert(strcmp(reordered.labels[perm.newIndex[u]], g.labels[u]) == 0);
+        for (int v = 0; v < g.n; v++)
+            assert(reordered.adj[perm.newIndex[u]][perm.newIndex[v]] == g.adj[u][v]);
+    }
+}
+
+// Time rounds of Breadth-First Search and Dijkstra's Algorithm from every Source
+void timeSearches(Graph *g, int rounds, double *bfsSeconds, double *djkSeconds)
+{
+    int dist[MAX_VERTICES], prev[MAX_VERTICES], order[MAX_VERTICES];
+    volatile int sink = 0;
+
+    // Warm up once so the first Order timed does not pay for cold Caches
+    for (int u = 0; u < g->n; u++)
+        sink += bfsDistances(g, u, dist, order) + djkDistances(g, u, dist, prev, order);
+
+    double start = parallelTime();
+    for (int r = 0; r < rounds; r++)
+        for (int u = 0; u < g->n; u++)
+            sink += bfsDistances(g, u, dist, order);
+    *bfsSeconds = parallelTime() - start;
+
+    start = parallelTime();
+    for (int r = 0; r < rounds; r++)
+        for (int u = 0; u < g->n; u++)
+            sink += djkDistances(g, u, dist, prev, order);
+    *djkSeconds = parallelTime() - start;
+}
+
+// Print the Locality and Search Times of the Graph in its current Order and in every Reordering
+void reorderReport(Graph *g, int rounds)
+{
+    const char *names[] = {"Original", "Reverse Cuthill-McKee", "Degree", "Breadth-First"};
+    double span, bfsSeconds, djkSeconds;
+
+    for (int m = -1; m <= REORDER_BFS; m++)
+    {
+        Graph reordered, *target = g;
+        if (m >= 0)
+        {
+            Permutation perm;
+            reorderPermutation(g, (ReorderMethod)m, &perm);
+            permuteGraph(g, &perm, &reordered);
+            target = &reordered;
+        }
+
+        int bandwidth = adjacencyBandwidth(target, &span);
+        timeSearches(target, rounds, &bfsSeconds, &djkSeconds);
+        printf("%s: Bandwidth %d, Mean Edge Span %.2f, BFS %.3f ms, Dijkstra %.3f ms\n", names[m + 1], bandwidth, span,
+            bfsSeconds * 1000.0, djkSeconds * 1000.0);
+
+        if (m >= 0)
+            graphDeinit(&reordered);
+    }
+}
+
+// Reorder - Test Case 1
+int test1()
+{
+    // A Path 0 - 1 - ... - 19 scattered across Indices by a Stride of 7
+    graphInit(&g, 20, NULL);
+    for (int i = 0; i < 19; i++)
+        g.adj[(i * 7) % 20][((i + 1) * 7) % 20] = 1;
+    graphTouch(&g);
+    assert(adjacencyBandwidth(&g, NULL) > 1);
+
+    reorderPermutation(&g, REORDER_RCM, &perm);
+    checkPermutation();
+    assert(adjacencyBandwidth(&reordered, NULL) == 1);
+    graphDeinit(&reordered);
+
+    reorderPermutation(&g, REORDER_BFS, &perm);
+    checkPermutation();
+    graphDeinit(&reordered);
+
+    // Results on the reordered Graph map back to the original Vertices
+    int dist[MAX_VERTICES], order[MAX_VERTICES], mapped[MAX_VERTICES], expected[MAX_VERTICES];
+    reorderPermutation(&g, REORDER_DEGREE, &perm);
+    checkPermutation();
+    bfsDistances(&reordered, perm.newIndex[0], dist, order);
+    permuteBack(&perm, dist, mapped);
+    bfsDistances(&g, 0, expected, order);
+    for (int v = 0; v < g.n; v++)
+        assert(mapped[v] == expected[v]);
+    graphDeinit(&reordered);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// Reorder - Test Case 2
+int test2()
+{
+    srand(39);
+    for (int round = 0; round < 20; round++)
+    {
+        graphInit(&g, MAX_VERTICES - round, NULL);
+        for (int i = 0; i < g.n; i++)
+            for (int j = 0; j < g.n; j++)
+                if (i != j && rand() % (16 + 4 * round) == 0)
+                    g.adj[i][j] = 1 + rand() % 5;
+        graphTouch(&g);
+
+        for (int m = REORDER_RCM; m <= REORDER_BFS; m++)
+        {
+            reorderPermutation(&g, (ReorderMethod)m, &perm);
+            checkPermutation();
+            graphDeinit(&reordered);
+        }
+
+        // Degree Order puts Hubs first
+        int degree[MAX_VERTICES];
+        reorderPermutation(&g, REORDER_DEGREE, &perm);
+        for (int i = 0; i < g.n; i++)
+        {
+            degree[i] = 0;
+            for (int v = 0; v < g.n; v++)
+                if (v != perm.oldIndex[i] && (g.adj[perm.oldIndex[i]][v] || g.adj[v][perm.oldIndex[i]]))
+                    degree[i]++;
+            if (i > 0)
+                assert(degree[i - 1] >= degree[i]);
+        }
+
+        graphDeinit(&g);
+    }
+    return 1;
+}
+
+// Reorder - Test Case 3
+int test3()
+{
+    // A 8 x 8 Grid with its Vertices shuffled, every Reordering brings Neighbours closer
+    graphInit(&g, 64, NULL);
+    int shuffled[64];
+    for (int i = 0; i < 64; i++)
+        shuffled[i] = (i * 37) % 64;
+    for (int r = 0; r < 8; r++)
+        for (int c = 0; c < 8; c++)
+        {
+            if (c + 1 < 8)
+                g.adj[shuffled[r * 8 + c]][shuffled[r * 8 + c + 1]] = 1 + (r + c) % 4;
+            if (r + 1 < 8)
+                g.adj[shuffled[r * 8 + c]][shuffled[(r + 1) * 8 + c]] = 1 + (r * c) % 4;
+        }
+    graphTouch(&g);
+
+    double span, reorderedSpan;
+    adjacencyBandwidth(&g, &span);
+    reorderPermutation(&g, REORDER_RCM, &perm);
+    checkPermutation();
+    assert(adjacencyBandwidth(&reordered, &reorderedSpan) <= 8 && reorderedSpan < span);
+    graphDeinit(&reordered);
+
+    reorderReport(&g, 20);
+    graphDeinit(&g);
+    return 1;
+}
+
+int main(void)
+{
+    printf("Reorder - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Reorder - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    printf("Reorder - Test 3 %s\n", test3() ? "PASSED" : "FAILED");
+    return 0;
+}
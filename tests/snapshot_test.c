@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <assert.h>
+
+#include "../src/snapshot.h"
+
+#define TEST_STEPS 200000
+
+SnapshotBuffer buffer;
+atomic_bool writerDone;
+
+// Fill a Snapshot so every Field depends on the Step, and a torn one is easy to spot
+void fill(AlgorithmSnapshot *snapshot, int step)
+{
+    snapshot->current = step;
+    snapshot->childrenTop = step % MAX_VERTICES;
+    for (int i = 0; i < MAX_VERTICES; i++)
+    {
+        snapshot->visited[i] = (i <= step % MAX_VERTICES);
+        snapshot->distance[i] = step + i;
+        snapshot->items[i] = step;
+    }
+}
+
+// Check if a Snapshot was filled for a single Step
+bool consistent(AlgorithmSnapshot *snapshot)
+{
+    int step = snapshot->current;
+    if (snapshot->childrenTop != step % MAX_VERTICES)
+        return false;
+    for (int i = 0; i < MAX_VERTICES; i++)
+        if (snapshot->visited[i] != (i <= step % MAX_VERTICES) || snapshot->distance[i] != step + i || snapshot->items[i] != step)
+            return false;
+    return true;
+}
+
+// Publish TEST_STEPS Snapshots as fast as possible
+void *writer(void *arg)
+{
+    (void)arg;
+    for (int step = 1; step <= TEST_STEPS; step++)
+    {
+        fill(snapshotBack(&buffer), step);
+        snapshotPublish(&buffer);
+    }
+    atomic_store(&writerDone, true);
+    return NULL;
+}
+
+// Snapshot - Test Case 1
+int test1()
+{
+    // Nothing published yet gives the empty Snapshot
+    snapshotInit(&buffer);
+    AlgorithmSnapshot *snapshot = snapshotRead(&buffer);
+    assert(snapshot->current == -1 && snapshot->src == -1 && snapshot->pathHead == MAX_VERTICES);
+    assert(snapshot->step == 0);
+
+    // The Reader sees the latest Snapshot, and keeps it until something newer is published
+    fill(snapshotBack(&buffer), 1);
+    snapshotPublish(&buffer);
+    fill(snapshotBack(&buffer), 2);
+    snapshotPublish(&buffer);
+    snapshot = snapshotRead(&buffer);
+    assert(snapshot->current == 2 && snapshot->step == 2);
+    assert(snapshotRead(&buffer) == snapshot);
+
+    // The Writer never gets the Slot the Reader holds
+    for (int step = 3; step < 10; step++)
+    {
+        assert(snapshotBack(&buffer) != snapshot);
+        fill(snapshotBack(&buffer), step);
+        snapshotPublish(&buffer);
+    }
+    assert(snapshot->current == 2);
+    assert(snapshotRead(&buffer)->current == 9);
+    return 1;
+}
+
+// Snapshot - Test Case 2
+int test2()
+{
+    // A Reader racing the Writer only ever sees whole Snapshots, in the Order they were published
+    snapshotInit(&buffer);
+    atomic_store(&writerDone, false);
+    pthread_t thread;
+    pthread_create(&thread, NULL, writer, NULL);
+
+    int last = 0, reads = 0;
+    while (!atomic_load(&writerDone) || last != TEST_STEPS)
+    {
+        AlgorithmSnapshot *snapshot = snapshotRead(&buffer);
+        if (snapshot->step == 0)
+            continue;
+        assert(consistent(snapshot));
+        assert(snapshot->current >= last);
+        assert(snapshot->step == snapshot->current);
+        last = snapshot->current;
+        reads++;
+    }
+    pthread_join(thread, NULL);
+    assert(reads > 0);
+    return 1;
+}
+
+int main(void)
+{
+    printf("Snapshot - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Snapshot - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "../src/spanningTree.h"
+
+Graph g;
+
+// Spanning Tree - Test Case 1
+int test1()
+{
+    graphInit(&g, 9, NULL);
+
+    editEdge(&g, "0", "1", 4);
+    editEdge(&g, "0", "7", 8);
+    editEdge(&g, "1", "2", 8);
+    editEdge(&g, "1", "7", 11);
+    editEdge(&g, "2", "3", 7);
+    editEdge(&g, "2", "5", 4);
+    editEdge(&g, "2", "8", 2);
+    editEdge(&g, "3", "4", 9);
+    editEdge(&g, "3", "5", 14);
+    editEdge(&g, "4", "5", 10);
+    editEdge(&g, "5", "6", 2);
+    editEdge(&g, "6", "7", 1);
+    editEdge(&g, "6", "8", 6);
+    editEdge(&g, "7", "8", 7);
+
+    SpanningForest kruskal, boruvka;
+    spanningForestInit(&kruskal);
+    spanningForestInit(&boruvka);
+
+    assert(kruskalSpanningForest(&g, true, &kruskal) == 8);
+    assert(kruskal.totalWeight == 37);
+    assert(kruskal.treeCount == 1);
+
+    assert(boruvkaSpanningForest(&g, true, &boruvka, 4) == 8);
+    assert(boruvka.totalWeight == 37);
+
+    // Every Forest Edge follows an Edge of the Graph
+    for (int k = 0; k < kruskal.edgeCount; k++)
+        assert(g.adj[kruskal.from[k]][kruskal.to[k]] == kruskal.weight[k]);
+
+    // Without undirected only Edges stored both Ways count
+    assert(kruskalSpanningForest(&g, false, &kruskal) == 0);
+    assert(kruskal.treeCount == 9);
+    editEdge(&g, "1", "0", 4);
+    assert(kruskalSpanningForest(&g, false, &kruskal) == 1);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// Spanning Tree - Test Case 2
+int test2()
+{
+    srand(11);
+    for (int round = 0; round < 50; round++)
+    {
+        graphInit(&g, MAX_VERTICES, NULL);
+        for (int i = 0; i < g.n; i++)
+            for (int j = 0; j < g.n; j++)
+                if (i != j && rand() % 20 == 0)
+                    g.adj[i][j] = 1 + rand() % 50;
+        graphTouch(&g);
+
+        SpanningForest kruskal, boruvka;
+        kruskalSpanningForest(&g, true, &kruskal);
+        boruvkaSpanningForest(&g, true, &boruvka, 4);
+
+        assert(kruskal.edgeCount == boruvka.edgeCount);
+        assert(kruskal.totalWeight == boruvka.totalWeight);
+        assert(kruskal.treeCount == boruvka.treeCount);
+        assert(kruskal.version == g.version);
+
+        graphDeinit(&g);
+    }
+    return 1;
+}
+
+int main(void)
+{
+    printf("Spanning Tree - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Spanning Tree - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    return 0;
+}
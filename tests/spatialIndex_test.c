@@ -0,0 +1,198 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "../src/spatialIndex.h"
+
+Graph g;
+SpatialIndex spatial;
+Vector2 points[MAX_VERTICES];
+
+float distanceSquared(Vector2 a, Vector2 b)
+{
+    return (a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y);
+}
+
+// Squared Distance from p to the Segment a-b
+float segmentDistanceSquared(Vector2 p, Vector2 a, Vector2 b)
+{
+    float dx = b.x - a.x, dy = b.y - a.y, lengthSquared = dx * dx + dy * dy;
+    float t = (lengthSquared > 0.0f) ? ((p.x - a.x) * dx + (p.y - a.y) * dy) / lengthSquared : 0.0f;
+    t = (t < 0.0f) ? 0.0f : (t > 1.0f) ? 1.0f : t;
+    return distanceSquared(p, (Vector2){a.x + t * dx, a.y + t * dy});
+}
+
+// Check every Query against a Scan of all Points and Edges
+void checkQueries(Vector2 p)
+{
+    int nearest = 0, under = -1, edge = -1;
+    float edgeDistance = 0.0f;
+    for (int v = 0; v < g.n; v++)
+    {
+        if (distanceSquared(p, points[v]) < distanceSquared(p, points[nearest]))
+            nearest = v;
+        if (distanceSquared(p, points[v]) <= 24.0f * 24.0f && (under == -1 || distanceSquared(p, points[v]) < distanceSquared(p, points[under])))
+            under = v;
+        for (int w = 0; w < g.n; w++)
+        {
+            float d = segmentDistanceSquared(p, points[v], points[w]);
+            if (g.adj[v][w] && v != w && d <= 36.0f && (edge == -1 || d < edgeDistance))
+            {
+                edge = v * MAX_VERTICES + w;
+                edgeDistance = d;
+            }
+        }
+    }
+
+    int found = spatialNearestVertex(&spatial, p);
+    assert(distanceSquared(p, points[found]) == distanceSquared(p, points[nearest]));
+    found = spatialVertexAt(&spatial, p, 24.0f);
+    assert((found == -1) == (under == -1));
+    if (under != -1)
+        assert(distanceSquared(p, points[found]) == distanceSquared(p, points[under]));
+
+    int u, v;
+    bool hit = spatialEdgeAt(&spatial, p, 6.0f, &u, &v);
+    assert(hit == (edge != -1));
+    if (hit)
+        assert(segmentDistanceSquared(p, points[u], points[v]) == edgeDistance && g.adj[u][v]);
+}
+
+// Spatial Index - Test Case 1
+int test1()
+{
+    graphInit(&g, 3, NULL);
+    g.adj[0][1] = 1;
+    graphTouch(&g);
+    points[0] = (Vector2){100, 100};
+    points[1] = (Vector2){400, 100};
+    points[2] = (Vector2){-250, 700};
+
+    spatialIndexInit(&spatial, SPATIAL_CELL_SIZE);
+    spatialIndexSync(&spatial, &g, points, 3);
+    assert(spatialVertexAt(&spatial, (Vector2){110, 95}, 24.0f) == 0);
+    assert(spatialVertexAt(&spatial, (Vector2){250, 100}, 24.0f) == -1);
+    assert(spatialNearestVertex(&spatial, (Vector2){-2000, 2000}) == 2);
+
+    int u, v;
+    assert(spatialEdgeAt(&spatial, (Vector2){250, 104}, 6.0f, &u, &v) && u == 0 && v == 1);
+    assert(!spatialEdgeAt(&spatial, (Vector2){250, 120}, 6.0f, &u, &v));
+
+    // Dragging a Point takes its Edges along
+    points[1] = (Vector2){100, 500};
+    spatialIndexMove(&spatial, &g, 1, points[1]);
+    assert(!spatialEdgeAt(&spatial, (Vector2){250, 104}, 6.0f, &u, &v));
+    assert(spatialEdgeAt(&spatial, (Vector2){98, 300}, 6.0f, &u, &v) && u == 0 && v == 1);
+
+    spatialIndexDeinit(&spatial);
+    graphDeinit(&g);
+    return 1;
+}
+
+// Spatial Index - Test Case 2
+int test2()
+{
+    srand(42);
+    spatialIndexInit(&spatial, SPATIAL_CELL_SIZE);
+    for (int round = 0; round < 10; round++)
+    {
+        graphInit(&g, MAX_VERTICES, NULL);
+        for (int i = 0; i < g.n; i++)
+        {
+            points[i] = (Vector2){(float)(rand() % 1280), (float)(rand() % 720)};
+            for (int j = 0; j < g.n; j++)
+                if (i != j && rand() % 12 == 0)
+                    g.adj[i][j] = 1;
+        }
+        graphTouch(&g);
+        spatialIndexSync(&spatial, &g, points, g.n);
+
+        for (int step = 0; step < 200; step++)
+        {
+            // Drag a random Point, then query around the Screen
+            int moved = rand() % g.n;
+            points[moved] = (Vector2){(float)(rand() % 1280), (float)(rand() % 720)};
+            if (step % 2)
+                spatialIndexMove(&spatial, &g, moved, points[moved]);
+            else
+                spatialIndexSync(&spatial, &g, points, g.n);
+
+            checkQueries((Vector2){(float)(rand() % 1400 - 60), (float)(rand() % 800 - 40)});
+            checkQueries(points[rand() % g.n]);
+        }
+        graphDeinit(&g);
+    }
+    spatialIndexDeinit(&spatial);
+    return 1;
+}
+
+// Spatial Index - Test Case 3
+int test3()
+{
+    srand(7);
+    spatialIndexInit(&spatial, SPATIAL_CELL_SIZE);
+    graphInit(&g, MAX_VERTICES, NULL);
+    for (int i = 0; i < g.n; i++)
+    {
+        points[i] = (Vector2){(float)(rand() % 2560 - 640), (float)(rand() % 1440 - 360)};
+        for (int j = 0; j < g.n; j++)
+            if (i != j && rand() % 10 == 0)
+                g.adj[i][j] = 1;
+    }
+    g.adj[5][5] = 1;
+    graphTouch(&g);
+    spatialIndexSync(&spatial, &g, points, g.n);
+
+    for (int round = 0; round < 500; round++)
+    {
+        // Views from a few Pixels up to far more Cells than there are Buckets
+        float size = (float)(rand() % ((round % 2) ? 200 : 6000) + 1);
+        Rectangle rect = {(float)(rand() % 2560 - 640), (float)(rand() % 1440 - 360), size, size * 0.5625f};
+        int vertices[MAX_VERTICES], edges[MAX_VERTICES * MAX_VERTICES];
+        bool found[MAX_VERTICES * MAX_VERTICES] = {false};
+
+        int count = spatialVerticesInRect(&spatial, rect, vertices), expected = 0;
+        for (int v = 0; v < g.n; v++)
+            if (points[v].x >= rect.x && points[v].x <= rect.x + rect.width && points[v].y >= rect.y && points[v].y <= rect.y + rect.height)
+                assert(vertices[expected++] == v);
+        assert(count == expected);
+
+        count = spatialEdgesInRect(&spatial, rect, edges);
+        for (int k = 0; k < count; k++)
+        {
+            assert(!found[edges[k]]);
+            found[edges[k]] = true;
+        }
+        for (int u = 0; u < g.n; u++)
+            for (int v = 0; v < g.n; v++)
+            {
+                Vector2 a = points[u], b = points[v], middle = {(a.x + b.x) / 2, (a.y + b.y) / 2};
+                bool touches = false, apart = (a.x < rect.x && b.x < rect.x) || (a.x > rect.x + rect.width && b.x > rect.x + rect.width) ||
+                                              (a.y < rect.y && b.y < rect.y) || (a.y > rect.y + rect.height && b.y > rect.y + rect.height);
+                for (int k = 0; k < 3; k++)
+                {
+                    Vector2 p = (k == 0) ? a : (k == 1) ? b : middle;
+                    touches |= p.x >= rect.x && p.x <= rect.x + rect.width && p.y >= rect.y && p.y <= rect.y + rect.height;
+                }
+
+                // Only real Edges come back, every Edge with a Point inside does, and none lying clear of the Rectangle
+                if (!g.adj[u][v] || u == v)
+                    assert(!found[u * MAX_VERTICES + v]);
+                else if (touches)
+                    assert(found[u * MAX_VERTICES + v]);
+                else if (apart)
+                    assert(!found[u * MAX_VERTICES + v]);
+            }
+    }
+    graphDeinit(&g);
+    spatialIndexDeinit(&spatial);
+    return 1;
+}
+
+int main(void)
+{
+    printf("Spatial Index - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Spatial Index - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    printf("Spatial Index - Test 3 %s\n", test3() ? "PASSED" : "FAILED");
+    return 0;
+}
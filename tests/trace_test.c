@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <assert.h>
+
+#include "../src/trace.h"
+
+#define TEST_THREADS 4
+#define TEST_SPANS 1000
+
+const char *threadNames[TEST_THREADS] = {"Worker 0", "Worker 1", "Worker 2", "Worker 3"};
+
+// Count the Occurrences of a String in a File
+int countInFile(const char *path, const char *needle)
+{
+    FILE *file = fopen(path, "r");
+    assert(file != NULL);
+    static char contents[4 * 1024 * 1024];
+    size_t length = fread(contents, 1, sizeof(contents) - 1, file);
+    fclose(file);
+    contents[length] = '\0';
+
+    int count = 0;
+    for (char *at = strstr(contents, needle); at != NULL; at = strstr(at + 1, needle))
+        count++;
+    return count;
+}
+
+// Record a Span with an Instant inside it, TEST_SPANS times
+void *worker(void *arg)
+{
+    traceThreadName(threadNames[*(int *)arg]);
+    for (int i = 0; i < TEST_SPANS; i++)
+    {
+        traceBegin("Step");
+        traceInstant("Visit");
+        traceEnd("Step");
+    }
+    return NULL;
+}
+
+// Trace - Test Case 1
+int test1()
+{
+    // Nothing is recorded before a Capture starts
+    traceBegin("Ignored");
+    traceEnd("Ignored");
+    assert(!traceActive());
+
+    // Threads recording at once each get their own Buffer
+    traceStart();
+    assert(traceActive());
+    pthread_t threads[TEST_THREADS];
+    int ids[TEST_THREADS];
+    for (int t = 0; t < TEST_THREADS; t++)
+    {
+        ids[t] = t;
+        pthread_create(&threads[t], NULL, worker, &ids[t]);
+    }
+    for (int t = 0; t < TEST_THREADS; t++)
+        pthread_join(threads[t], NULL);
+    traceStop();
+    traceInstant("Ignored");
+
+    assert(traceDump("trace_test.json") == 0);
+    assert(countInFile("trace_test.json", "\"ph\":\"B\"") == TEST_THREADS * TEST_SPANS);
+    assert(countInFile("trace_test.json", "\"ph\":\"E\"") == TEST_THREADS * TEST_SPANS);
+    assert(countInFile("trace_test.json", "\"ph\":\"i\"") == TEST_THREADS * TEST_SPANS);
+    assert(countInFile("trace_test.json", "\"thread_name\"") == TEST_THREADS);
+    assert(countInFile("trace_test.json", "\"Worker 2\"") == 1);
+    assert(countInFile("trace_test.json", "Ignored") == 0);
+    assert(traceDropped() == 0);
+
+    remove("trace_test.json");
+    return 1;
+}
+
+// Trace - Test Case 2
+int test2()
+{
+    // A full Buffer drops further Events instead of overwriting
+    traceStart();
+    for (int i = 0; i < TRACE_BUFFER_EVENTS + 10; i++)
+        traceInstant("Tick");
+    traceStop();
+    assert(traceDropped() == 10);
+
+    assert(traceDump("trace_test.json") == 0);
+    assert(countInFile("trace_test.json", "\"Tick\"") == TRACE_BUFFER_EVENTS);
+
+    // A new Capture starts empty
+    traceStart();
+    traceInstant("Tick");
+    traceStop();
+    assert(traceDropped() == 0);
+    assert(traceDump("trace_test.json") == 0);
+    assert(countInFile("trace_test.json", "\"Tick\"") == 1);
+
+    // An unwritable Path is reported
+    assert(traceDump("missing/trace_test.json") == -1);
+
+    // Captures after the Buffers are freed record into new ones
+    traceDeinit();
+    assert(!traceActive() && traceDropped() == 0);
+    traceStart();
+    traceInstant("Tick");
+    traceStop();
+    assert(traceDump("trace_test.json") == 0);
+    assert(countInFile("trace_test.json", "\"Tick\"") == 1);
+    traceDeinit();
+
+    remove("trace_test.json");
+    return 1;
+}
+
+int main(void)
+{
+    printf("Trace - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Trace - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    return 0;
+}
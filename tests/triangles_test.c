@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+
+#include "../src/triangles.h"
+
+Graph g;
+TriangleResult result, parallelResult;
+
+// Triangles - Test Case 1
+int test1()
+{
+    // Two Triangles sharing the Edge 1 - 2, plus a Tail 3 - 4
+    graphInit(&g, 5, NULL);
+    addEdge(&g, "0", "1");
+    addEdge(&g, "1", "2");
+    addEdge(&g, "2", "0");
+    addEdge(&g, "1", "3");
+    addEdge(&g, "3", "2");
+    addEdge(&g, "3", "4");
+
+    triangleResultInit(&result);
+    assert(countTriangles(&g, 1, &result) == 2);
+
+    assert(result.vertexTriangles[0] == 1);
+    assert(result.vertexTriangles[1] == 2);
+    assert(result.vertexTriangles[2] == 2);
+    assert(result.vertexTriangles[3] == 1);
+    assert(result.vertexTriangles[4] == 0);
+
+    assert(fabsf(result.clustering[0] - 1.0f) < 1e-6f);
+    assert(fabsf(result.clustering[1] - 2.0f / 3.0f) < 1e-6f);
+    assert(fabsf(result.clustering[3] - 1.0f / 3.0f) < 1e-6f);
+    assert(result.clustering[4] == 0.0f);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+// Triangles - Test Case 2
+int test2()
+{
+    srand(13);
+    graphInit(&g, MAX_VERTICES, NULL);
+    for (int i = 0; i < g.n; i++)
+        for (int j = 0; j < g.n; j++)
+            if (i != j && rand() % 6 == 0)
+                g.adj[i][j] = 1;
+    graphTouch(&g);
+
+    // Triple Loop over the Adjacency Matrix as Reference
+    long long expected = 0;
+    for (int a = 0; a < g.n; a++)
+        for (int b = a + 1; b < g.n; b++)
+            for (int c = b + 1; c < g.n; c++)
+                if ((g.adj[a][b] || g.adj[b][a]) && (g.adj[b][c] || g.adj[c][b]) && (g.adj[a][c] || g.adj[c][a]))
+                    expected++;
+
+    assert(countTriangles(&g, 1, &result) == expected);
+    assert(countTriangles(&g, 4, &parallelResult) == expected);
+    for (int i = 0; i < g.n; i++)
+        assert(result.vertexTriangles[i] == parallelResult.vertexTriangles[i]);
+
+    // Complete Graph has Clustering 1 everywhere
+    for (int i = 0; i < g.n; i++)
+        for (int j = 0; j < g.n; j++)
+            g.adj[i][j] = (i != j);
+    graphTouch(&g);
+    assert(countTriangles(&g, 4, &result) == (long long)MAX_VERTICES * (MAX_VERTICES - 1) * (MAX_VERTICES - 2) / 6);
+    assert(fabsf(result.averageClustering - 1.0f) < 1e-5f);
+
+    graphDeinit(&g);
+    return 1;
+}
+
+int main(void)
+{
+    printf("Triangles - Test 1 %s\n", test1() ? "PASSED" : "FAILED");
+    printf("Triangles - Test 2 %s\n", test2() ? "PASSED" : "FAILED");
+    return 0;
+}